@@ -0,0 +1,244 @@
+using System;
+using System.IO;
+using System.Collections;
+using System.Diagnostics;
+using System.Globalization;
+
+namespace Zen;
+
+/// Times the compiler on generated programs of a few sizes (see ProgramGenerator), from building them all the way to running them through TinyCC.
+/// Every size is built ITERATIONS times from scratch with a fresh Builder, and the best time of every phase is kept, since that's the least noisy one.
+/// The first build of a size is kept apart from the best time: StringInterner.Global lives as long as the process does,
+/// so only that build interns the program's names, every later one finds them already there.
+/// The results go to bench.json in the benchmark directory, keep one around from before a change to compare against.
+class Benchmark
+{
+	public const String RESULTS_FILE_NAME = "bench.json";
+	private const int ITERATIONS = 5;
+
+	private static ProgramSize[3] s_sizes = .(
+		.("small",   4,  16,  4,  4, 16,  2),
+		.("medium", 16,  64, 16,  8, 32,  4),
+		.("large",  64, 128, 32, 16, 64, 16)
+	);
+
+	/// Profiler zones, each one is summed over the whole build (so the per file front end zones add up over every worker).
+	/// "Run" isn't a zone, it's timed here.
+	private static String[?] s_phases = .(
+		"Build",
+		"Loader",
+		"Tokenizer",
+		"DirectivePreprocessor",
+		"Parser",
+		"Binder",
+		"Checker",
+		"Reachability",
+		"Generator",
+		"TCC prelude",
+		"TCC compile",
+		"TCC relocate",
+		"Run"
+	);
+
+	private class SizeResult
+	{
+		public ProgramSize Size;
+		public int Files;
+		public int Lines;
+		public int Bytes;
+		/// Indexed like s_phases, over every build after the first.
+		public double[] Best ~ delete _;
+		/// Indexed like s_phases, the first build.
+		public double[] Cold ~ delete _;
+
+		/// Megabytes of source the tokenizer gets through per second, on one thread (its zone is summed over the workers).
+		public double LexerMBPerSecond
+		{
+			get
+			{
+				for (let phase in s_phases)
+				{
+					if (phase == "Tokenizer" && Best[@phase.Index] > 0)
+						return Bytes / (1024.0 * 1024.0) / Best[@phase.Index];
+				}
+				return 0;
+			}
+		}
+
+		public this()
+		{
+			Best = new .[s_phases.Count];
+			for (var best in ref Best)
+				best = double.MaxValue;
+			Cold = new .[s_phases.Count];
+		}
+	}
+
+	private readonly String m_directory = new .() ~ delete _;
+	private readonly BuildContext m_context;
+	private readonly List<SizeResult> m_results = new .() ~ DeleteContainerAndItems!(_);
+
+	public this(StringView directory, BuildContext context)
+	{
+		m_directory.Set(directory);
+		m_context = context;
+	}
+
+	public Result<void> Run()
+	{
+		// The phases come from the profiler.
+		m_context.Profile = true;
+		m_context.PrintScopes = false;
+		m_context.PrintStripped = false;
+
+		for (let size in s_sizes)
+		{
+			let result = new SizeResult() { Size = size };
+			m_results.Add(result);
+
+			Try!(runSize(result));
+			printResult(result);
+		}
+
+		let path = Path.Combine(.. scope .(), m_directory, RESULTS_FILE_NAME);
+		Try!(writeResults(path));
+
+		Console.ForegroundColor = .DarkGray;
+		Console.WriteLine(scope $"Results written to {path}");
+		Console.ResetColor();
+
+		return .Ok;
+	}
+
+	private Result<void> runSize(SizeResult result)
+	{
+		let sizeDirectory = Path.Combine(.. scope .(), m_directory, result.Size.Name);
+		let outputDirectory = Path.Combine(.. scope .(), sizeDirectory, "output", "src");
+
+		let generator = scope ProgramGenerator(result.Size);
+		let mainPath = scope String();
+		Try!(generator.Write(sizeDirectory, mainPath));
+
+		result.Files = generator.FilesWritten;
+		result.Lines = generator.LinesWritten;
+		result.Bytes = generator.BytesWritten;
+
+		Console.ForegroundColor = .White;
+		Console.WriteLine(scope $"{result.Size.Name}: {result.Files} files, {result.Lines} lines");
+		Console.ResetColor();
+
+		let stopwatch = scope Stopwatch();
+
+		for (int i = 0; i < ITERATIONS; i++)
+		{
+			// Otherwise every build after the first would be up to date.
+			File.Delete(Path.Combine(.. scope .(), outputDirectory, BuildCache.FILE_NAME)).IgnoreError();
+
+			let files = scope List<CFile>();
+			defer files.ClearAndDeleteItems();
+
+			let builder = scope Builder();
+			let buildResult = builder.Run(mainPath, outputDirectory, files, m_context);
+			if (buildResult case .Err)
+			{
+				builder.RenderDiagnostics();
+
+				Console.ForegroundColor = .Red;
+				Console.WriteLine(scope $"The generated '{result.Size.Name}' program failed to compile.");
+				Console.ResetColor();
+				return .Err;
+			}
+
+			// Split builds include the declarations header from here.
+			if (builder.WriteOutputFiles(buildResult.Value.Files, outputDirectory) case .Err)
+				return .Err;
+
+			let runtime = scope TccRuntime();
+			if (runtime.Load(buildResult.Value.Files, outputDirectory, builder.Profiler) case .Err)
+				return .Err;
+
+			stopwatch.Restart();
+			runtime.RunMain();
+			stopwatch.Stop();
+
+			for (let phase in s_phases)
+			{
+				let seconds = (phase == "Run") ? stopwatch.Elapsed.TotalSeconds : builder.Profiler.GetTotal(phase).TotalSeconds;
+				if (i == 0)
+					result.Cold[@phase.Index] = seconds;
+				else
+					result.Best[@phase.Index] = Math.Min(result.Best[@phase.Index], seconds);
+			}
+		}
+
+		return .Ok;
+	}
+
+	private static void appendSeconds(String outStr, double seconds)
+	{
+		seconds.ToString(outStr, "0.000000", CultureInfo.InvariantCulture);
+	}
+
+	private void printResult(SizeResult result)
+	{
+		for (let phase in s_phases)
+		{
+			Console.ForegroundColor = .White;
+			Console.Write(scope $"  {phase}:");
+			Console.ForegroundColor = .DarkGray;
+			Console.WriteLine(scope $" {appendSeconds(.. scope .(), result.Best[@phase.Index])}s (cold {appendSeconds(.. scope .(), result.Cold[@phase.Index])}s)");
+		}
+
+		Console.ForegroundColor = .White;
+		Console.Write("  Lexer:");
+		Console.ForegroundColor = .DarkGray;
+		Console.WriteLine(scope $" {result.LexerMBPerSecond.ToString(.. scope .(), "0.00", CultureInfo.InvariantCulture)} MB/s");
+		Console.ResetColor();
+	}
+
+	private static void appendPhases(String json, double[] seconds)
+	{
+		json.Append('{');
+		for (let phase in s_phases)
+		{
+			if (@phase.Index > 0)
+				json.Append(", ");
+			Profiler.AppendJsonString(json, phase);
+			json.Append(": ");
+			appendSeconds(json, seconds[@phase.Index]);
+		}
+		json.Append('}');
+	}
+
+	private Result<void> writeResults(StringView path)
+	{
+		let json = scope String();
+		json.Append(scope $"\{\n  \"iterations\": {ITERATIONS},\n  \"config\": ");
+		Profiler.AppendJsonString(json, m_context.GetCacheKey(.. scope .()));
+		json.Append(",\n  \"sizes\": [");
+
+		for (let result in m_results)
+		{
+			if (@result.Index > 0)
+				json.Append(',');
+
+			let size = result.Size;
+			json.Append("\n    {\"name\": ");
+			Profiler.AppendJsonString(json, size.Name);
+			json.Append(scope $", \"namespaces\": {size.Namespaces}, \"functionsPerNamespace\": {size.FunctionsPerNamespace}");
+			json.Append(scope $", \"structsPerNamespace\": {size.StructsPerNamespace}, \"enumsPerNamespace\": {size.EnumsPerNamespace}");
+			json.Append(scope $", \"expressionDepth\": {size.ExpressionDepth}, \"loadChainLength\": {size.LoadChainLength}");
+			json.Append(scope $", \"files\": {result.Files}, \"lines\": {result.Lines}, \"bytes\": {result.Bytes}");
+			json.Append(scope $", \"lexerMBPerSecond\": {result.LexerMBPerSecond.ToString(.. scope .(), "0.00", CultureInfo.InvariantCulture)}");
+			json.Append(",\n     \"seconds\": ");
+			appendPhases(json, result.Best);
+			json.Append(",\n     \"coldSeconds\": ");
+			appendPhases(json, result.Cold);
+			json.Append("}");
+		}
+
+		json.Append("\n  ]\n}\n");
+
+		return File.WriteAllText(path, json);
+	}
+}
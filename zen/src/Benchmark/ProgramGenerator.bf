@@ -0,0 +1,205 @@
+using System;
+using System.IO;
+using System.Collections;
+
+namespace Zen;
+
+/// How big a generated benchmark program is, see ProgramGenerator.
+struct ProgramSize
+{
+	public StringView Name;
+	public int Namespaces;
+	public int FunctionsPerNamespace;
+	public int StructsPerNamespace;
+	public int EnumsPerNamespace;
+	/// How deeply every function's return expression is nested.
+	public int ExpressionDepth;
+	/// How many namespace files load each other in a row before the main file has to start a new chain.
+	public int LoadChainLength;
+
+	public this(StringView name, int namespaces, int functions, int structs, int enums, int depth, int chain)
+	{
+		this.Name = name;
+		this.Namespaces = namespaces;
+		this.FunctionsPerNamespace = functions;
+		this.StructsPerNamespace = structs;
+		this.EnumsPerNamespace = enums;
+		this.ExpressionDepth = depth;
+		this.LoadChainLength = chain;
+	}
+}
+
+/// Writes out a synthetic Zen program of a given size, for timing the compiler on more than the samples under 'test/'.
+/// Every namespace goes into its own file. The files are loaded in chains (each one loads the next), and main calls into all of them,
+/// so nothing gets stripped as dead code. The same size always generates the same program.
+class ProgramGenerator
+{
+	public const String MAIN_FILE_NAME = "main.zen";
+
+	private readonly ProgramSize m_size;
+
+	public int FilesWritten { get; private set; }
+	public int LinesWritten { get; private set; }
+	public int BytesWritten { get; private set; }
+
+	public this(ProgramSize size)
+	{
+		this.m_size = size;
+	}
+
+	/// Writes every file into directory, outMainPath gets the file to build.
+	public Result<void> Write(StringView directory, String outMainPath)
+	{
+		Directory.CreateDirectory(directory).IgnoreError();
+
+		FilesWritten = 0;
+		LinesWritten = 0;
+		BytesWritten = 0;
+
+		let text = scope String();
+
+		for (int ns = 0; ns < m_size.Namespaces; ns++)
+		{
+			text.Clear();
+			writeNamespace(ns, text);
+			Try!(writeFile(directory, scope $"ns{ns}.zen", text));
+		}
+
+		text.Clear();
+		writeMain(text);
+		Path.Combine(outMainPath, directory, MAIN_FILE_NAME);
+		Try!(writeFile(directory, MAIN_FILE_NAME, text));
+
+		return .Ok;
+	}
+
+	private Result<void> writeFile(StringView directory, StringView name, String text)
+	{
+		let path = Path.Combine(.. scope .(), directory, name);
+		if (File.WriteAllText(path, text) case .Err)
+		{
+			Console.ForegroundColor = .DarkRed;
+			Console.WriteLine(scope $"Couldn't write {path}");
+			Console.ResetColor();
+			return .Err;
+		}
+
+		FilesWritten++;
+		for (let c in text.RawChars)
+		{
+			if (c == '\n')
+				LinesWritten++;
+		}
+		BytesWritten += text.Length;
+		return .Ok;
+	}
+
+	private bool startsChain(int ns)
+	{
+		return ns % Math.Max(m_size.LoadChainLength, 1) == 0;
+	}
+
+	private void writeMain(String text)
+	{
+		for (int ns = 0; ns < m_size.Namespaces; ns++)
+		{
+			if (startsChain(ns))
+				text.Append(scope $"#load \"ns{ns}.zen\";\n");
+		}
+
+		text.Append("\nfun void main()\n{\n\tvar int total = 0;\n");
+		for (int ns = 0; ns < m_size.Namespaces; ns++)
+		{
+			text.Append(scope $"\ttotal = (total + ns{ns}::entry()) % 1000003;\n");
+		}
+		text.Append("\tprintln(total);\n}\n");
+	}
+
+	private void writeNamespace(int ns, String text)
+	{
+		// The rest of the chain.
+		if (ns + 1 < m_size.Namespaces && !startsChain(ns + 1))
+			text.Append(scope $"#load \"ns{ns + 1}.zen\";\n\n");
+
+		text.Append(scope $"namespace ns{ns};\n\n");
+
+		for (int e = 0; e < m_size.EnumsPerNamespace; e++)
+		{
+			text.Append(scope $"enum Kind{e}\n");
+			text.Append("{\n\tFirst,\n\tSecond,\n\tThird\n}\n\n");
+		}
+
+		for (int s = 0; s < m_size.StructsPerNamespace; s++)
+		{
+			text.Append(scope $"struct Data{s}\n");
+			text.Append("{\n\tint a;\n\tint b;\n\tfloat c;\n");
+			if (m_size.EnumsPerNamespace > 0)
+				text.Append(scope $"\tKind{s % m_size.EnumsPerNamespace} kind;\n");
+			text.Append("}\n\n");
+		}
+
+		for (int f = 0; f < m_size.FunctionsPerNamespace; f++)
+		{
+			writeFunction(f, text);
+		}
+
+		text.Append("fun int entry()\n{\n\tvar int total = 0;\n");
+		for (int f = 0; f < m_size.FunctionsPerNamespace; f++)
+		{
+			text.Append(scope $"\ttotal = (total + f{f}({f % 17}, {f % 5})) % 1000003;\n");
+		}
+		text.Append("\treturn total;\n}\n");
+	}
+
+	private void writeFunction(int f, String text)
+	{
+		text.Append(scope $"fun int f{f}(int x, int y)\n");
+		text.Append("{\n");
+
+		let hasStruct = m_size.StructsPerNamespace > 0;
+		if (hasStruct)
+		{
+			let s = f % m_size.StructsPerNamespace;
+			text.Append(scope $"\tvar Data{s} d;\n\td.a = x;\n\td.b = y + {f};\n\td.c = cast(float)x * 0.5;\n");
+			if (m_size.EnumsPerNamespace > 0)
+				text.Append(scope $"\td.kind = Kind{s % m_size.EnumsPerNamespace}::Second;\n");
+		}
+
+		// Only ever the previous function, so the calls chain through the namespace without the run time blowing up.
+		if (f > 0)
+			text.Append(scope $"\tlet int previous = f{f - 1}(y, x) % 101;\n");
+		else
+			text.Append("\tlet int previous = 1;\n");
+
+		text.Append("\treturn ");
+		writeExpression(f, m_size.ExpressionDepth, hasStruct, text);
+		text.Append(";\n}\n\n");
+	}
+
+	/// Nested to the left, '(((x + 1) * 3) - y) % 1009...', so the size grows with the depth instead of doubling.
+	/// The modulo every few levels keeps the intermediate values small enough to never overflow.
+	private void writeExpression(int f, int depth, bool hasStruct, String text)
+	{
+		if (depth <= 0)
+		{
+			text.Append("x");
+			return;
+		}
+
+		text.Append('(');
+		writeExpression(f, depth - 1, hasStruct, text);
+
+		switch ((depth + f) % 6)
+		{
+		case 0: text.Append(" + previous");
+		case 1: text.Append(" * 3");
+		case 2: text.Append(hasStruct ? " - d.b" : " - y");
+		case 3: text.Append(" % 1009");
+		// Constant, so it exercises the folder.
+		case 4: text.Append(scope $" + ({depth} * 4 - 2)");
+		case 5: text.Append(hasStruct ? " + d.a" : " + x");
+		}
+
+		text.Append(')');
+	}
+}
@@ -0,0 +1,238 @@
+using System;
+using System.IO;
+using System.Collections;
+
+namespace Zen;
+
+/// Persistent record of the last successful build, stored next to the generated files.
+/// It remembers a content hash for every source file in the '#load' graph and for every generated file,
+/// so an unchanged project can skip the whole pipeline and unchanged outputs don't get rewritten.
+class BuildCache
+{
+	public const String FILE_NAME = ".zencache";
+
+	/// Bump this whenever the generated code or this file's format changes shape, so old caches don't claim to be up to date.
+	private const int VERSION = 3;
+
+	public class FileEntry
+	{
+		public readonly String Path = new .() ~ delete _;
+		public readonly uint64 Hash;
+		public readonly List<String> Loads = new .() ~ DeleteContainerAndItems!(_);
+
+		public this(StringView path, uint64 hash)
+		{
+			this.Path.Set(path);
+			this.Hash = hash;
+		}
+	}
+
+	private readonly String m_mainPath = new .() ~ delete _;
+	/// BuildContext.GetCacheKey() of the build that produced the outputs.
+	private readonly String m_config = new .() ~ delete _;
+	private readonly List<FileEntry> m_files = new .() ~ DeleteContainerAndItems!(_);
+	private readonly Dictionary<String, uint64> m_outputs = new .() ~ DeleteDictionaryAndKeys!(_);
+
+	/// Warnings only come out of the pipeline, so a build that had any never counts as up to date.
+	/// Otherwise they'd only show up the first time and be gone on every build after it.
+	public int WarningCount;
+
+	public List<FileEntry> Files => m_files;
+
+	public const uint64 HASH_SEED = 0xcbf29ce484222325;
+
+	/// 64-bit FNV-1a. Not cryptographic, we only need to notice edits.
+	/// Pass the previous result as the seed to hash text that's split up into pieces.
+	public static uint64 Hash(StringView text, uint64 seed = HASH_SEED)
+	{
+		uint64 hash = seed;
+		for (let c in text)
+		{
+			hash ^= (uint8)c;
+			hash *= 0x100000001b3;
+		}
+		return hash;
+	}
+
+	public void Clear()
+	{
+		m_mainPath.Clear();
+		m_config.Clear();
+		m_files.ClearAndDeleteItems();
+		WarningCount = 0;
+		for (let key in m_outputs.Keys)
+		{
+			delete key;
+		}
+		m_outputs.Clear();
+	}
+
+	/// Starts recording a new '#load' graph, the outputs are kept since they're still what's on disk.
+	public void BeginFiles(StringView mainPath, StringView config)
+	{
+		m_mainPath.Set(mainPath);
+		m_config.Set(config);
+		m_files.ClearAndDeleteItems();
+	}
+
+	public FileEntry AddFile(StringView path, uint64 hash)
+	{
+		let entry = new FileEntry(path, hash);
+		m_files.Add(entry);
+		return entry;
+	}
+
+	public bool TryGetOutputHash(StringView name, out uint64 hash)
+	{
+		return m_outputs.TryGetValue(scope String(name), out hash);
+	}
+
+	public void GetOutputNames(List<String> outNames)
+	{
+		for (let name in m_outputs.Keys)
+		{
+			outNames.Add(new .(name));
+		}
+	}
+
+	public void RemoveOutput(StringView name)
+	{
+		if (m_outputs.GetAndRemove(scope String(name)) case .Ok(let pair))
+			delete pair.key;
+	}
+
+	public void SetOutput(StringView name, uint64 hash)
+	{
+		let key = scope String(name);
+		if (m_outputs.ContainsKey(key))
+			m_outputs[key] = hash;
+		else
+			m_outputs.Add(new .(name), hash);
+	}
+
+	/// Checks every recorded source and output file against what's on disk.
+	/// Counts unchanged sources as hits and changed ones as misses.
+	public bool IsUpToDate(StringView mainPath, StringView config, StringView outputDirectory, ref int hits, ref int misses)
+	{
+		if (m_files.IsEmpty || m_mainPath != mainPath || m_config != config || WarningCount > 0)
+			return false;
+
+		bool upToDate = true;
+		for (let file in m_files)
+		{
+			let content = scope String();
+			if (File.ReadAllText(file.Path, content) case .Ok && Hash(content) == file.Hash)
+			{
+				hits++;
+			}
+			else
+			{
+				misses++;
+				upToDate = false;
+			}
+		}
+
+		if (!upToDate)
+			return false;
+
+		for (let output in m_outputs)
+		{
+			let path = Path.Combine(.. scope .(), outputDirectory, output.key);
+			let content = scope String();
+			if (File.ReadAllText(path, content) case .Err || Hash(content) != output.value)
+				return false;
+		}
+
+		return true;
+	}
+
+	public void Load(StringView cachePath)
+	{
+		Clear();
+
+		let text = scope String();
+		if (File.ReadAllText(cachePath, text) case .Err)
+			return;
+
+		FileEntry currentFile = null;
+		bool versionMatches = false;
+
+		for (let rawLine in text.Split('\n'))
+		{
+			let line = scope String(rawLine)..Trim();
+
+			let space = line.IndexOf(' ');
+			if (space == -1)
+				continue;
+
+			let key = line.Substring(0, space);
+			let value = line.Substring(space + 1);
+
+			switch (key)
+			{
+			case "zencache":
+				if (int.Parse(value) case .Ok(let version))
+					versionMatches = (version == VERSION);
+			case "main":
+				m_mainPath.Set(value);
+			case "config":
+				m_config.Set(value);
+			case "warnings":
+				if (int.Parse(value) case .Ok(let count))
+					WarningCount = count;
+			case "file":
+				if (splitHashAndPath(value) case .Ok(let entry))
+					currentFile = AddFile(entry.path, entry.hash);
+			case "load":
+				if (currentFile != null)
+					currentFile.Loads.Add(new .(value));
+			case "output":
+				if (splitHashAndPath(value) case .Ok(let entry))
+					SetOutput(entry.path, entry.hash);
+			default:
+			}
+		}
+
+		// Stale or foreign format, act as if there was no cache at all.
+		if (!versionMatches)
+			Clear();
+	}
+
+	/// Splits "<hash> <path>", paths are allowed to contain spaces.
+	private static Result<(uint64 hash, StringView path)> splitHashAndPath(StringView value)
+	{
+		let hashEnd = value.IndexOf(' ');
+		if (hashEnd == -1)
+			return .Err;
+
+		if (uint64.Parse(value.Substring(0, hashEnd)) case .Ok(let hash))
+			return .Ok((hash, value.Substring(hashEnd + 1)));
+
+		return .Err;
+	}
+
+	public void Save(StringView cachePath)
+	{
+		let text = scope String();
+		text.Append(scope $"zencache {VERSION}\n");
+		text.Append(scope $"main {m_mainPath}\n");
+		text.Append(scope $"config {m_config}\n");
+		text.Append(scope $"warnings {WarningCount}\n");
+
+		for (let file in m_files)
+		{
+			text.Append(scope $"file {file.Hash} {file.Path}\n");
+			for (let load in file.Loads)
+			{
+				text.Append(scope $"load {load}\n");
+			}
+		}
+
+		for (let output in m_outputs)
+		{
+			text.Append(scope $"output {output.value} {output.key}\n");
+		}
+
+		File.WriteAllText(cachePath, text);
+	}
+}
@@ -1,6 +1,29 @@
+using System;
+
 namespace Zen;
 
+/// Options for a single build, filled in from the command line.
 class BuildContext
 {
+	public bool PrintScopes = false;
+
+	/// Emit one C file per namespace plus a shared declarations header, instead of a single main.c.
+	public bool SplitTranslationUnits = false;
+
+	/// Record timed zones for every phase and file, see Builder.Profiler. Doesn't change the output.
+	public bool Profile = false;
+
+	/// Only generate the declarations main (or the hot reload hooks) can reach, see Reachability.
+	public bool StripDeadCode = true;
+	/// Lists what StripDeadCode left out.
+	public bool PrintStripped = false;
+
+	/// Guard array accesses the Checker couldn't prove are in bounds (see BoundsCheck), off for release builds.
+	public bool BoundsChecks = true;
 
-}
\ No newline at end of file
+	/// Everything that changes the generated code has to be in here, otherwise the build cache would hand out stale output.
+	public void GetCacheKey(String outKey)
+	{
+		outKey.Append(scope $"split={SplitTranslationUnits};dce={StripDeadCode};bounds={BoundsChecks}");
+	}
+}
@@ -2,6 +2,7 @@ using System;
 using System.IO;
 using System.Collections;
 using System.Diagnostics;
+using System.Threading;
 
 namespace Zen;
 
@@ -9,6 +10,34 @@ class Builder
 {
 	private const ConsoleColor CONSOLE_CODE_COLOR = .Gray;
 
+	/// Everything the front end produces for a single file, filled in by whichever worker picked the file up.
+	private class FileJob
+	{
+		public readonly SourceFileID ID;
+		public readonly String Path = new .() ~ delete _;
+
+		public uint64 Hash;
+		public CompFile Comp ~ { if (!Reused) delete _; }
+		/// The compiled file came from a previous run of this builder.
+		public bool Reused;
+
+		public readonly List<Diagnostic> Diagnostics = new .() ~ DeleteContainerAndItems!(_);
+
+		/// The files this one loads, in '#load' order. Used to merge the results in a deterministic order.
+		public readonly List<SourceFileID> Loads = new .() ~ delete _;
+
+		public this(SourceFileID id, StringView path)
+		{
+			this.ID = id;
+			this.Path.Set(path);
+		}
+
+		public void AddDiagnostic(Diagnostic diag)
+		{
+			Diagnostics.Add(diag);
+		}
+	}
+
 	private readonly List<Diagnostic> m_diagnostics = new .() ~ DeleteContainerAndItems!(_);
 	private readonly DiagnosticRenderer m_diagnosticsRenderer = new .(CONSOLE_CODE_COLOR) ~ delete _;
 
@@ -17,36 +46,115 @@ class Builder
 
 	private SourceFileID m_currentFileID = 0;
 
-	private Dictionary<SourceFileID, SourceFile> m_knownFiles = new .() ~ DeleteDictionaryAndValues!(_);
-	private Dictionary<SourceFileID, CompFile> m_compFiles = new .() ~ DeleteDictionaryAndValues!(_);
+	private readonly SourceManager m_sources = new .() ~ delete _;
 
-	// public int FilesWritten => m_writtenFiles.Count;
-	// public List<String> WrittenFiles => m_writtenFiles;
+	/// Compiled files by path, kept between runs so unchanged files skip the tokenizer and parser.
+	private Dictionary<String, CompFile> m_compFileCache = new .() ~ DeleteDictionaryAndKeysAndValues!(_);
+	private readonly BuildCache m_cache = new .() ~ delete _;
+
+	private int m_cacheHits = 0;
+	private int m_cacheMisses = 0;
+	private int m_filesWritten = 0;
+	private int m_filesUnchanged = 0;
+	private bool m_upToDate = false;
+
+	/// Compiled files in the order a serial depth-first walk of the '#load' graph visits them.
+	private List<CompFile> m_fileOrder = new .() ~ delete _;
+
+	// Front end job state, m_loadMonitor guards everything here since the workers share it.
+	private readonly Monitor m_loadMonitor = new .() ~ delete _;
+	private Dictionary<String, SourceFileID> m_filesByPath = new .() ~ DeleteDictionaryAndKeys!(_);
+	private Dictionary<SourceFileID, FileJob> m_jobs = new .() ~ DeleteDictionaryAndValues!(_);
+	private int64 m_lexerTicks = 0;
+	private int64 m_parserTicks = 0;
+
+	private readonly WorkerPool m_pool = new .(Math.Max(Environment.ProcessorCount - 1, 0)) ~ delete _;
 
 	public readonly int ErrorCount => m_errorCount;
 	public readonly int WarningCount => m_warningCount;
 
-	public readonly Stopwatch StopwatchLexer = new .() ~ delete _;
-	public readonly Stopwatch StopwatchParser = new .() ~ delete _;
+	/// Files whose front end work was skipped, either because the whole build was up to date or because the file didn't change since the last run.
+	public readonly int CacheHits => m_cacheHits;
+	public readonly int CacheMisses => m_cacheMisses;
+
+	public readonly int FilesWritten => m_filesWritten;
+	public readonly int FilesUnchanged => m_filesUnchanged;
+
+	/// Nothing changed since the last build, so nothing was generated and the files on disk are still valid.
+	public readonly bool UpToDate => m_upToDate;
+
+	/// Every source file the last run got to, in '#load' order.
+	public List<BuildCache.FileEntry> SourceFiles => m_cache.Files;
+
+	/// Wall time of the whole front end (lexing, preprocessing and parsing every file on the worker pool).
+	public readonly Stopwatch StopwatchLoader = new .() ~ delete _;
 	public readonly Stopwatch StopwatchChecker = new .() ~ delete _;
 	public readonly Stopwatch StopwatchCodegen = new .() ~ delete _;
 
+	/// Timed zones of the last run, only recorded when the build context asks for profiling.
+	public readonly Profiler Profiler = new .() ~ delete _;
+
+	/// Time spent in the tokenizer, summed over all the workers.
+	public TimeSpan LexerTime => TimeSpan(m_lexerTicks);
+	/// Time spent in the preprocessor and parser, summed over all the workers.
+	public TimeSpan ParserTime => TimeSpan(m_parserTicks);
+
 	public ~this()
 	{
 		Console.ResetColor();
 	}
 
-	public Result<Generator.GeneratorResult> Run(String mainFilePath, String outputDirectory, List<CFile> outCFiles, bool printScopes)
+	public Result<Generator.GeneratorResult> Run(String mainFilePath, String outputDirectory, List<CFile> outCFiles, BuildContext context)
+	{
+		beginRun();
+		Profiler.Clear();
+		Profiler.Enabled = context.Profile;
+
+		using (Profiler.Begin("Build", "build", mainFilePath))
+		{
+			return run(mainFilePath, outputDirectory, outCFiles, context);
+		}
+	}
+
+	private Result<Generator.GeneratorResult> run(String mainFilePath, String outputDirectory, List<CFile> outCFiles, BuildContext context)
 	{
+		let config = context.GetCacheKey(.. scope .());
+
+		let mainPath = Path.GetActualPathName(mainFilePath, .. scope .());
+
+		// ----------------------------------------------
+		// Build cache
+		// ----------------------------------------------
+		using (Profiler.Begin("BuildCache", "build"))
+		{
+			m_cache.Load(Path.Combine(.. scope .(), outputDirectory, BuildCache.FILE_NAME));
+
+			if (!context.PrintScopes && !context.PrintStripped && m_cache.IsUpToDate(mainPath, config, outputDirectory, ref m_cacheHits, ref m_cacheMisses))
+			{
+				m_upToDate = true;
+				return .Ok(default);
+			}
+		}
+
+		// The loader counts per file on its own.
+		m_cacheHits = 0;
+		m_cacheMisses = 0;
+
 		// ----------------------------------------------
 		// Load files (starting from the main file)
 		// ----------------------------------------------
-		Try!(parseFile(loadSourceFile(mainFilePath)));
+		StopwatchLoader.Start();
+		let loadZone = Profiler.Begin("Loader", "frontend");
+		let loadResult = loadFiles(mainPath, config);
+		loadZone.Dispose();
+		StopwatchLoader.Stop();
+
+		Try!(loadResult);
 
 		let finalAst = scope Ast();
-		for (let file in m_compFiles)
+		for (let file in m_fileOrder)
 		{
-			finalAst.AddRange(file.value.Ast);
+			finalAst.AddRange(file.Ast);
 		}
 
 		// ----------------------------------------------
@@ -55,38 +163,71 @@ class Builder
 
 		StopwatchChecker.Start();
 
+		let binderZone = Profiler.Begin("Binder", "semantic");
 		let scoper = scope Binder(finalAst);
 		addOnVisitorReport!(scoper);
-		let globalScope = Try!(scoper.Run());
+		let binderResult = scoper.Run();
+		binderZone.Count("entities", scoper.EntityCount);
+		binderZone.Count("arenaBytes", scoper.AllocatedBytes);
+		binderZone.Dispose();
+		let globalScope = Try!(binderResult);
 
 		StopwatchChecker.Stop();
 
-		if (printScopes)
+		if (context.PrintScopes)
 		{
 			Binder.PrintScopeTree(globalScope);
 		}
 
+		// ----------------------------------------------
+		// Checker (resolves types on demand as well)
+		// ----------------------------------------------
+
 		StopwatchChecker.Start();
 
+		let types = scope TypeTable();
+
+		let checker = scope Checker(finalAst, globalScope, types);
+		addOnVisitorReport!(checker);
+		using (let zone = Profiler.Begin("Checker", "semantic"))
+		{
+			let checkResult = checker.Run();
+			zone.Count("types", types.Count);
+			Try!(checkResult);
+		}
+
 		// ----------------------------------------------
-		// Type resolver
+		// Compile time execution ('#run')
 		// ----------------------------------------------
 
-		let resolver = scope Resolver(finalAst, globalScope);
-		addOnVisitorReport!(resolver);
-		Try!(resolver.Run());
-
-		StopwatchChecker.Stop();
+		CompileTimeRunner runner = null;
+		if (!checker.Runs.IsEmpty)
+		{
+			runner = scope:: CompileTimeRunner();
+			runner.OnReport.Add(scope:: => addDiagnostic);
+			using (let zone = Profiler.Begin("CompileTimeRunner", "semantic"))
+			{
+				zone.Count("runs", checker.Runs.Count);
+				Try!(runner.Run(checker.Runs, finalAst, globalScope, types, outputDirectory, m_pool, Profiler));
+			}
+		}
 
 		// ----------------------------------------------
-		// Checker
+		// Reachability (what main can get to)
 		// ----------------------------------------------
 
-		StopwatchChecker.Start();
+		Reachability reachability = null;
+		if (context.StripDeadCode)
+		{
+			reachability = scope:: Reachability(globalScope);
+			using (Profiler.Begin("Reachability", "semantic"))
+			{
+				reachability.Run();
+			}
 
-		let checker = scope Checker(finalAst, globalScope);
-		addOnVisitorReport!(checker);
-		Try!(checker.Run());
+			if (context.PrintStripped)
+				reachability.PrintStripped();
+		}
 
 		StopwatchChecker.Stop();
 
@@ -96,127 +237,397 @@ class Builder
 
 		StopwatchCodegen.Start();
 
-		let gen = scope Generator(finalAst, globalScope, outCFiles);
+		let gen = scope Generator(finalAst, globalScope, types, reachability, outCFiles, context, m_pool, Profiler);
+		gen.BakedGlobals = runner?.BakedGlobals;
+		let genZone = Profiler.Begin("Generator", "codegen");
 		let c = gen.Generate();
+		genZone.Dispose();
 
 		StopwatchCodegen.Stop();
 
 		return .Ok(c);
 	}
 
-	private Result<CompFile> parseFile(SourceFile source)
+	/// Writes the generated files that actually changed since the last build, then saves the build cache.
+	/// Leaving identical files alone keeps C compilers and file watchers from doing needless work.
+	/// Fails if any file couldn't be written, the build cache is thrown away then so the next build doesn't call itself up to date.
+	public Result<void> WriteOutputFiles(List<CFile> files, String outputDirectory)
 	{
-		let comp = Try!(parseFileWithID(source, source.ID));
-		m_compFiles.Add(source.ID, comp);
+		let zone = Profiler.Begin("WriteOutputFiles", "build");
+		defer zone.Dispose();
 
-		// Load files from the preprocessor
-		for (let fileLoad in comp.PreprocessingResult.FilesToLoad)
+		Directory.CreateDirectory(outputDirectory).IgnoreError();
+
+		bool writeFailed = false;
+		for (let file in files)
+		{
+			let path = Path.Combine(.. scope .(), outputDirectory, file.Name);
+			let hash = file.Hash();
+
+			if (m_cache.TryGetOutputHash(file.Name, let cachedHash) && cachedHash == hash && File.Exists(path))
+			{
+				m_filesUnchanged++;
+				continue;
+			}
+
+			if (file.WriteTo(path) case .Err)
+			{
+				Console.ForegroundColor = .DarkRed;
+				Console.WriteLine(scope $"Couldn't write {path}");
+				Console.ResetColor();
+
+				writeFailed = true;
+				continue;
+			}
+
+			m_cache.SetOutput(file.Name, hash);
+			m_filesWritten++;
+		}
+
+		// Left over from a build with different options, they'd otherwise get picked up when running the output.
+		let previousOutputs = m_cache.GetOutputNames(.. scope .());
+		defer previousOutputs.ClearAndDeleteItems();
+
+		outer: for (let name in previousOutputs)
+		{
+			for (let file in files)
+			{
+				if (file.Name == name)
+					continue outer;
+			}
+
+			File.Delete(Path.Combine(.. scope .(), outputDirectory, name)).IgnoreError();
+			m_cache.RemoveOutput(name);
+		}
+
+		let cachePath = Path.Combine(.. scope .(), outputDirectory, BuildCache.FILE_NAME);
+		if (writeFailed)
+		{
+			File.Delete(cachePath).IgnoreError();
+			return .Err;
+		}
+
+		m_cache.WarningCount = m_warningCount;
+		m_cache.Save(cachePath);
+		return .Ok;
+	}
+
+	/// Resets everything that belongs to a single build, the compiled file cache survives between runs.
+	private void beginRun()
+	{
+		m_diagnostics.ClearAndDeleteItems();
+		m_errorCount = 0;
+		m_warningCount = 0;
+
+		m_cacheHits = 0;
+		m_cacheMisses = 0;
+		m_filesWritten = 0;
+		m_filesUnchanged = 0;
+		m_upToDate = false;
+
+		m_lexerTicks = 0;
+		m_parserTicks = 0;
+		StopwatchLoader.Reset();
+		StopwatchChecker.Reset();
+		StopwatchCodegen.Reset();
+
+		m_fileOrder.Clear();
+		for (let path in m_filesByPath.Keys)
+		{
+			delete path;
+		}
+		m_filesByPath.Clear();
+
+		// Sources that only stuck around for the last run's diagnostics.
+		let liveSources = scope HashSet<SourceFileID>();
+		for (let comp in m_compFileCache.Values)
+		{
+			liveSources.Add(comp.Source.ID);
+		}
+
+		let knownSources = scope List<SourceFileID>();
+		m_sources.GetFileIDs(knownSources);
+
+		for (let id in knownSources)
+		{
+			if (!liveSources.Contains(id))
+				m_sources.Remove(id);
+		}
+	}
+
+	private Result<void> loadFiles(String mainPath, StringView config)
+	{
+		SourceFileID mainID = 0;
+		using (m_loadMonitor.Enter())
+		{
+			mainID = queueFile(mainPath);
+		}
+
+		m_pool.WaitIdle();
+
+		// Merge in the order a serial walk would've visited the files, so diagnostics and declarations
+		// don't depend on which worker happened to finish first.
+		m_cache.BeginFiles(mainPath, config);
+		mergeFileJob(mainID, scope .());
+
+		// Files that aren't part of the build anymore.
+		let deadPaths = scope List<String>();
+		for (let cached in m_compFileCache)
+		{
+			if (!m_fileOrder.Contains(cached.value))
+				deadPaths.Add(cached.key);
+		}
+
+		for (let path in deadPaths)
+		{
+			evictCompFile(path);
+		}
+
+		for (let job in m_jobs.Values)
+		{
+			delete job;
+		}
+		m_jobs.Clear();
+
+		return (m_errorCount > 0) ? .Err : .Ok;
+	}
+
+	/// Registers a path and hands it off to the worker pool. m_loadMonitor has to be held when calling this.
+	private SourceFileID queueFile(StringView path)
+	{
+		let id = ++m_currentFileID;
+		let job = new FileJob(id, path);
+
+		m_filesByPath.Add(new .(path), id);
+		m_jobs.Add(id, job);
+		m_pool.Enqueue(new () => { parseJob(job); });
+
+		return id;
+	}
+
+	/// Runs on a worker thread, nothing in here may touch the builder without holding m_loadMonitor.
+	private void parseJob(FileJob job)
+	{
+		var source = new SourceFile(job.ID, job.Path);
+		job.Hash = source.Hash;
+
+		CompFile cached = null;
+		using (m_loadMonitor.Enter())
+		{
+			m_compFileCache.TryGetValue(job.Path, out cached);
+		}
+
+		if (cached != null && cached.Source.Hash == source.Hash)
+		{
+			// Unchanged since the last run, the tokens and AST can be reused as they are.
+			delete source;
+			source = cached.Source;
+
+			job.Comp = cached;
+			job.Reused = true;
+
+			using (m_loadMonitor.Enter())
+			{
+				m_cacheHits++;
+			}
+		}
+		else
 		{
-			let originFilePath = m_compFiles[fileLoad.Origin].Source.Path;
-			let originFileDirectory = Path.GetDirectoryPath(originFilePath, .. scope .());
+			m_sources.Add(source);
+
+			using (m_loadMonitor.Enter())
+			{
+				m_cacheMisses++;
+			}
+
+			if (parseFileWithID(source, job) case .Ok(let comp))
+			{
+				job.Comp = comp;
+			}
+			else
+			{
+				return;
+			}
+		}
 
+		// Load files from the preprocessor
+		let originFileDirectory = Path.GetDirectoryPath(source.Path, .. scope .());
+		for (let fileLoad in job.Comp.PreprocessingResult.FilesToLoad)
+		{
 			let loadFileName = fileLoad.Path;
 			let loadFilePath = Path.GetActualPathName(Path.Combine(.. scope .(), originFileDirectory, loadFileName), .. scope .());
 
-			if (originFilePath == loadFilePath)
+			if (source.Path == loadFilePath)
 			{
 				let span = new DiagnosticSpan()
 				{
 					Range = fileLoad.PathToken.SourceRange
 				};
-				addDiagnostic(new .(.Error, "File is attempting to load itself", span));
-				return .Err;
+				job.AddDiagnostic(new .(.Error, "File is attempting to load itself", span));
+				continue;
 			}
 
-			bool tryLoadFile = true;
-			for (let file in m_compFiles)
+			SourceFileID loadID = 0;
+			using (m_loadMonitor.Enter())
 			{
-				// This file is already loaded, we can safely ignore it.
-				if (file.value.Source.Path == loadFilePath)
-				{
-					tryLoadFile = false;
-					break;
-				}
+				// This file is already loaded (or another worker is on it), we can safely ignore it.
+				m_filesByPath.TryGetValue(loadFilePath, out loadID);
 			}
 
-			if (tryLoadFile)
+			if (loadID == 0 && File.Exists(loadFilePath))
 			{
-				if (File.Exists(loadFilePath))
+				using (m_loadMonitor.Enter())
 				{
-					Try!(parseFile(loadSourceFile(loadFilePath)));
-				}
-				else
-				{
-					let span = new DiagnosticSpan()
+					// Someone else might've queued it while we were checking the disk.
+					if (!m_filesByPath.TryGetValue(loadFilePath, out loadID))
 					{
-						Range = fileLoad.PathToken.SourceRange
-					};
-					addDiagnostic(new .(.Error, "File not found", span));
+						loadID = queueFile(loadFilePath);
+					}
 				}
 			}
+
+			if (loadID != 0)
+			{
+				job.Loads.Add(loadID);
+			}
+			else
+			{
+				let span = new DiagnosticSpan()
+				{
+					Range = fileLoad.PathToken.SourceRange
+				};
+				job.AddDiagnostic(new .(.Error, "File not found", span));
+			}
+		}
+	}
+
+	private void mergeFileJob(SourceFileID id, HashSet<SourceFileID> visited)
+	{
+		if (!visited.Add(id))
+			return;
+
+		let job = m_jobs[id];
+
+		for (let diag in job.Diagnostics)
+		{
+			addDiagnostic(diag);
+		}
+		job.Diagnostics.Clear();
+
+		if (job.Comp != null)
+		{
+			let comp = job.Comp;
+			job.Comp = null;
+
+			if (!job.Reused)
+			{
+				evictCompFile(job.Path);
+				m_compFileCache.Add(new .(job.Path), comp);
+			}
+
+			m_fileOrder.Add(comp);
+		}
+
+		// Recorded even if the file failed to parse, so watching the build still notices when it gets fixed.
+		let entry = m_cache.AddFile(job.Path, job.Hash);
+		for (let load in job.Loads)
+		{
+			entry.Loads.Add(new .(m_jobs[load].Path));
+		}
+
+		for (let load in job.Loads)
+		{
+			mergeFileJob(load, visited);
 		}
+	}
+
+	private void evictCompFile(StringView path)
+	{
+		if (m_compFileCache.GetAndRemove(scope String(path)) case .Ok(let pair))
+		{
+			let sourceID = pair.value.Source.ID;
 
-		return comp;
+			delete pair.key;
+			delete pair.value;
+			m_sources.Remove(sourceID);
+		}
 	}
 
-	private Result<CompFile> parseFileWithID(SourceFile source, SourceFileID fileID)
+	private Result<CompFile> parseFileWithID(SourceFile source, FileJob job)
 	{
 		let outTokens = new List<Token>();
 		let ast = new Ast();
 		let pp = new PreprocessingResult();
+		let arena = new BumpAllocator();
 
 		mixin TryCleanup(var result)
 		{
 			if (result case .Err(var err))
 			{
 				delete outTokens;
-				DeleteContainerAndItems!(ast);
+				delete ast;
 				delete pp;
+				delete arena;
 
 				return .Err((.)err);
 			}
 			result.Get()
 		}
 
+		let stopwatch = scope Stopwatch();
+		let fileZone = Profiler.Begin("CompFile", "frontend", source.Path);
+		defer fileZone.Dispose();
+		fileZone.Count("bytes", source.Content.Length);
+
 		// ----------------------------------------------
 		// Tokenize file
 		// ----------------------------------------------
-		StopwatchLexer.Start();
+		stopwatch.Start();
 
-		let tokenizer = scope Tokenizer(source.Content, fileID);
+		let tokenizerZone = Profiler.Begin("Tokenizer", "frontend", source.Path);
+		let tokenizer = scope Tokenizer(source);
 		let inTokens = tokenizer.Run();
+		outTokens.Reserve(inTokens.Count);
+		tokenizerZone.Count("tokens", inTokens.Count);
+		tokenizerZone.Dispose();
 
-		StopwatchLexer.Stop();
+		stopwatch.Stop();
+		let lexerTicks = stopwatch.Elapsed.Ticks;
+		stopwatch.Reset();
+		stopwatch.Start();
 
 		// ----------------------------------------------
 		// Preprocessor
 		// ----------------------------------------------
+		let preprocessorZone = Profiler.Begin("DirectivePreprocessor", "frontend", source.Path);
 		let preprocessor = scope DirectivePreprocessor(inTokens);
-		addOnVisitorReport!(preprocessor);
-		TryCleanup!(preprocessor.Process(source, outTokens, pp));
+		preprocessor.OnReport.Add(scope => job.AddDiagnostic);
+		let preprocessResult = preprocessor.Process(source, outTokens, pp);
+		preprocessorZone.Dispose();
+		TryCleanup!(preprocessResult);
 
 		// ----------------------------------------------
 		// Parse file
 		// ----------------------------------------------
-		StopwatchParser.Start();
-
-		let parser = scope Parser(outTokens, ast);
-		addOnVisitorReport!(parser);
-		TryCleanup!(parser.Run());
-
-		StopwatchParser.Stop();
-
-		return .Ok(new CompFile(source, outTokens, ast, pp));
-	}
-
-	private SourceFile loadSourceFile(String path)
-	{
-		let actualPath = Path.GetActualPathName(path, .. scope .());
-		let id = ++m_currentFileID;
-		let source = new SourceFile(id, actualPath);
- 		m_knownFiles.Add(id, source);
+		let parserZone = Profiler.Begin("Parser", "frontend", source.Path);
+		let nodesBefore = AstNode.CreatedCount;
+		let parser = scope Parser(outTokens, ast, arena);
+		parser.OnReport.Add(scope => job.AddDiagnostic);
+		let parseResult = parser.Run();
+		parserZone.Count("nodes", AstNode.CreatedCount - nodesBefore);
+		parserZone.Count("arenaBytes", arena.GetAllocSize());
+		parserZone.Dispose();
+		TryCleanup!(parseResult);
+
+		stopwatch.Stop();
+
+		using (m_loadMonitor.Enter())
+		{
+			m_lexerTicks += lexerTicks;
+			m_parserTicks += stopwatch.Elapsed.Ticks;
+		}
 
-		return source;
+		return .Ok(new CompFile(source, outTokens, ast, pp, arena));
 	}
 
 	private mixin addOnVisitorReport(Visitor visitor)
@@ -232,13 +643,17 @@ class Builder
 		{
 			m_errorCount++;
 		}
+		else if (diag.Level == .Warning)
+		{
+			m_warningCount++;
+		}
 	}
 
 	public void RenderDiagnostics()
 	{
 		for (let diagnostic in m_diagnostics)
 		{
-			m_diagnosticsRenderer.WriteError(m_knownFiles, diagnostic);
+			m_diagnosticsRenderer.WriteError(m_sources, diagnostic);
 		}
 	}
 }
\ No newline at end of file
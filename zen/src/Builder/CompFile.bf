@@ -8,11 +8,14 @@ class CompFile
 	public readonly SourceFile Source;
 
 	public readonly List<Token> Tokens ~ delete _;
-	public readonly Ast Ast ~ DeleteContainerAndItems!(_);
+	public readonly Ast Ast ~ delete _;
 
 	public readonly PreprocessingResult PreprocessingResult ~ delete _;
 
-	public this(SourceFile file, List<Token> tokens, Ast ast, PreprocessingResult ppResult)
+	/// Owns every AST node of the file, they all go away at once with it.
+	public readonly BumpAllocator Arena ~ delete _;
+
+	public this(SourceFile file, List<Token> tokens, Ast ast, PreprocessingResult ppResult, BumpAllocator arena)
 	{
 		this.Source = file;
 
@@ -20,5 +23,6 @@ class CompFile
 		this.Ast = ast;
 
 		this.PreprocessingResult = ppResult;
+		this.Arena = arena;
 	}
 }
@@ -4,7 +4,7 @@ using System.Collections;
 
 namespace Zen;
 
-typealias SourceFileID = uint8;
+typealias SourceFileID = uint32;
 
 class SourceFile
 {
@@ -13,23 +13,83 @@ class SourceFile
 	public readonly String Path ~ delete _;
 	public readonly String Name ~ delete _;
 	public readonly String Content ~ delete _;
-	public readonly StringView[] Lines ~ delete _;
 
-	public this(SourceFileID id, String path)
+	/// Where the file starts in the SourceManager's offset space.
+	public uint32 BaseOffset { get; internal set; }
+
+	/// Offset of every line start, only built once a diagnostic needs a line or column.
+	private List<int> m_lineStarts = null ~ delete _;
+
+	/// Content hash, used by the build cache to tell whether the file changed.
+	public readonly uint64 Hash;
+
+	public this(SourceFileID id, String path) : this(id, path, File.ReadAllText(path, .. new .()))
+	{
+	}
+
+	/// Takes ownership of the content string.
+	public this(SourceFileID id, String path, String content)
 	{
 		this.ID = id;
 		this.Path = new .(path);
 		this.Name = System.IO.Path.GetFileName(path, .. new .());
-		this.Content = File.ReadAllText(path, .. new .());
+		this.Content = content;
+		this.Hash = BuildCache.Hash(content);
+	}
+
+	public SourceLocation GetLocation(int localOffset)
+	{
+		return .(BaseOffset + (uint32)localOffset);
+	}
+
+	public int GetLocalOffset(SourceLocation location)
+	{
+		return (int)(location.Offset - BaseOffset);
+	}
 
-		let split = Content.Split('\n');
-		let lines = scope List<StringView>();
-		for (let line in split)
+	/// Zero based line and column of a location inside this file.
+	public (int line, int column) GetLineColumn(SourceLocation location)
+	{
+		buildLineStarts();
+
+		let offset = GetLocalOffset(location);
+
+		// Last line starting at or before the offset.
+		int lo = 0;
+		int hi = m_lineStarts.Count - 1;
+		while (lo < hi)
 		{
-			lines.Add(line);
+			let mid = (lo + hi + 1) / 2;
+			if (m_lineStarts[mid] <= offset)
+				lo = mid;
+			else
+				hi = mid - 1;
 		}
 
-		this.Lines = new .[lines.Count];
-		lines.CopyTo(this.Lines);
+		return (lo, offset - m_lineStarts[lo]);
+	}
+
+	/// The text of a zero based line, without the line break.
+	public StringView GetLine(int line)
+	{
+		buildLineStarts();
+
+		let start = m_lineStarts[line];
+		let end = (line + 1 < m_lineStarts.Count) ? m_lineStarts[line + 1] - 1 : Content.Length;
+		return Content.Substring(start, end - start);
+	}
+
+	private void buildLineStarts()
+	{
+		if (m_lineStarts != null)
+			return;
+
+		m_lineStarts = new .();
+		m_lineStarts.Add(0);
+		for (let i < Content.Length)
+		{
+			if (Content[i] == '\n')
+				m_lineStarts.Add(i + 1);
+		}
 	}
 }
\ No newline at end of file
@@ -2,20 +2,14 @@ using System;
 
 namespace Zen;
 
+/// A position in the global offset space of the SourceManager.
+/// The file, line and column are only worked out when something actually needs them (see SourceManager and SourceFile).
 public struct SourceLocation
 {
-	public SourceFileID File;
+	public uint32 Offset;
 
-	public int Line;
-	public int Column;
-	/// Absolute position in the file
-	public int Offset;
-
-	public this(SourceFileID file, int line, int col, int offset)
+	public this(uint32 offset)
 	{
-		this.File = file;
-		this.Line = line;
-		this.Column = col;
 		this.Offset = offset;
 	}
 }
@@ -25,9 +19,11 @@ public struct SourceRange
 	public readonly SourceLocation Start;
 	public readonly SourceLocation End;
 
+	public int Length => (int)(End.Offset - Start.Offset);
+
 	public this(SourceLocation start, SourceLocation end)
 	{
 		this.Start = start;
 		this.End = end;
 	}
-}
\ No newline at end of file
+}
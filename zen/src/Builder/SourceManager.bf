@@ -0,0 +1,89 @@
+using System;
+using System.Collections;
+using System.Threading;
+
+namespace Zen;
+
+/// Owns every loaded source file and hands each of them a slice of one global 32-bit offset space,
+/// so a SourceLocation is nothing more than an offset. Files are registered from the loader's worker threads.
+class SourceManager
+{
+	private readonly Monitor m_monitor = new .() ~ delete _;
+
+	/// Sorted by base offset, since offsets are only ever handed out in increasing order.
+	private readonly List<SourceFile> m_files = new .() ~ DeleteContainerAndItems!(_);
+	private readonly Dictionary<SourceFileID, SourceFile> m_filesByID = new .() ~ delete _;
+
+	/// Zero is kept free so a default SourceLocation never points into a file.
+	private uint32 m_nextOffset = 1;
+
+	/// Takes ownership of the file and gives it its base offset.
+	public void Add(SourceFile file)
+	{
+		using (m_monitor.Enter())
+		{
+			// One past the end, so the EOF token still lands inside the file.
+			let length = (uint32)file.Content.Length + 1;
+			Runtime.Assert(m_nextOffset + (uint64)length <= uint32.MaxValue, "Ran out of source offsets");
+
+			file.BaseOffset = m_nextOffset;
+			m_nextOffset += length;
+
+			m_files.Add(file);
+			m_filesByID.Add(file.ID, file);
+		}
+	}
+
+	/// Deletes the file, any locations pointing into it become invalid.
+	public void Remove(SourceFileID id)
+	{
+		using (m_monitor.Enter())
+		{
+			if (m_filesByID.GetAndRemove(id) case .Ok(let pair))
+			{
+				m_files.Remove(pair.value);
+				delete pair.value;
+			}
+		}
+	}
+
+	public SourceFile GetFile(SourceFileID id)
+	{
+		using (m_monitor.Enter())
+		{
+			return m_filesByID[id];
+		}
+	}
+
+	public void GetFileIDs(List<SourceFileID> outIDs)
+	{
+		using (m_monitor.Enter())
+		{
+			outIDs.AddRange(m_filesByID.Keys);
+		}
+	}
+
+	/// Finds the file a location points into.
+	public Result<SourceFile> GetFile(SourceLocation location)
+	{
+		using (m_monitor.Enter())
+		{
+			int lo = 0;
+			int hi = m_files.Count - 1;
+			while (lo <= hi)
+			{
+				let mid = (lo + hi) / 2;
+				let file = m_files[mid];
+
+				if (location.Offset < file.BaseOffset)
+					hi = mid - 1;
+				else if (location.Offset > file.BaseOffset + (uint32)file.Content.Length)
+					lo = mid + 1;
+				else
+					return file;
+			}
+		}
+
+		return .Err;
+	}
+}
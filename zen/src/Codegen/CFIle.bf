@@ -1,15 +1,57 @@
 using System;
+using System.IO;
 
 namespace Zen;
 
 public class CFile
 {
 	public readonly String Name = new .() ~ delete _;
-	public readonly String Text = new .() ~ delete _;
+	private readonly StringCodeBuilder m_code ~ delete _;
 
-	public this(String name, String text)
+	/// Headers only get compiled through the files including them.
+	public bool IsTranslationUnit => Name.EndsWith(".c");
+
+	/// The whole file as one string, only TinyCC needs it like that.
+	public String Text => m_code.Code;
+
+	/// Takes ownership of the code.
+	public this(String name, StringCodeBuilder code)
+	{
+		this.Name.Set(name);
+		this.m_code = code;
+	}
+
+	public this(String name, StringView text)
 	{
 		this.Name.Set(name);
-		this.Text.Set(text);
+		this.m_code = new .(text);
+	}
+
+	public uint64 Hash() => m_code.Hash();
+
+	/// Streams the code straight from the builder's chunks to disk.
+	/// Goes through a file next to it first, so a write that fails halfway doesn't leave a cut off file behind.
+	public Result<void> WriteTo(StringView path)
+	{
+		let tempPath = scope $"{path}.tmp";
+		{
+			let stream = scope FileStream();
+			if (stream.Create(tempPath, .Write) case .Err)
+				return .Err;
+
+			if (m_code.WriteTo(stream) case .Err)
+			{
+				stream.Close();
+				File.Delete(tempPath).IgnoreError();
+				return .Err;
+			}
+		}
+
+		if (File.Move(tempPath, path) case .Err)
+		{
+			File.Delete(tempPath).IgnoreError();
+			return .Err;
+		}
+		return .Ok;
 	}
-}
\ No newline at end of file
+}
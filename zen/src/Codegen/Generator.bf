@@ -8,7 +8,22 @@ class Generator
 {
 	private readonly Ast m_ast;
 	private readonly Scope m_globalScope;
+	private readonly TypeTable m_types;
+	private readonly Reachability m_reachability;
 	private readonly List<CFile> m_outputFilesList;
+	private readonly BuildContext m_context;
+	private readonly WorkerPool m_pool;
+	private readonly Profiler m_profiler;
+
+	/// The struct of arrays types of every struct, they get declared and defined right after it.
+	private readonly Dictionary<AstNode.Stmt.StructDeclaration, List<TypeTable.TypeInfo>> m_soaTypes = new .() ~ DeleteDictionaryAndValues!(_);
+
+	/// The C initializers of globals a '#run' filled in, see CompileTimeRunner.
+	public Dictionary<Entity.Variable, String> BakedGlobals = null;
+
+	/// Set for the program CompileTimeRunner builds. Globals with a '#run' in their initializer are left at zero there,
+	/// so GenerateRunner() is the only place each '#run' gets called.
+	public bool SkipRunInitializers = false;
 
 	public struct GeneratorResult
 	{
@@ -22,10 +37,17 @@ class Generator
 		public bool FromConst;
 	}
 
-	private const String USER_SYMBOL_PREFIX = "zen";
+	public const String USER_SYMBOL_PREFIX = "zen";
+	public const String INIT_GLOBALS_SYMBOL = "zencg_initglobals";
+	public const String RUN_SYMBOL = "zencg_run";
+	public const String RUN_SIZES_SYMBOL = "zencg_run_sizes";
+	public const String RUN_FILE_NAME = "zen_run.c";
+	public const String DECLS_HEADER_NAME = "zen_decls.h";
 
 	const String BOILERPLATE =
 		"""
+		#pragma once
+
 		#include <stdio.h>
 		#include <stdlib.h>
 		#include <stdbool.h>
@@ -40,7 +62,7 @@ class Generator
 		typedef			 long long	int64;
 		typedef			 int		int32;
 		typedef			 short		int16;
-		typedef			 char		int8;
+		typedef	  signed char		int8;
 		typedef			 float		float32;
 		typedef			 double		float64;
 
@@ -73,36 +95,95 @@ class Generator
 		#endif
 
 		#include <raylib.h>
+
+		// Only called when the build has bounds checks on, see BoundsCheck.
+		static inline int64 zen_bounds_check(int64 index, int64 count)
+		{
+			if (index < 0 || index >= count)
+			{
+				fprintf(stderr, "Array index %lld is out of bounds for an array of %lld\n", index, count);
+				abort();
+			}
+			return index;
+		}
+
+		// Checks a whole counting loop up front, a counter going from start up to (not including) end in steps of step
+		// has to stay below count at the last index it gets to.
+		static inline void zen_bounds_check_loop(int64 start, int64 end, int64 step, int64 count)
+		{
+			if (start < end)
+			{
+				int64 last = start + (end - 1 - start) / step * step;
+				if (last >= count)
+				{
+					fprintf(stderr, "Loop runs up to index %lld, out of bounds for an array of %lld\n", last, count);
+					abort();
+				}
+			}
+		}
 		""";
 
-	public this(Ast ast, Scope globalScope, List<CFile> cfilesList)
+	public this(Ast ast, Scope globalScope, TypeTable types, Reachability reachability, List<CFile> cfilesList, BuildContext context, WorkerPool pool, Profiler profiler)
 	{
 		this.m_ast = ast;
 		this.m_globalScope = globalScope;
+		this.m_types = types;
+		this.m_reachability = reachability;
 		this.m_outputFilesList = cfilesList;
+		this.m_context = context;
+		this.m_pool = pool;
+		this.m_profiler = profiler;
 	}
 
 	public GeneratorResult Generate()
 	{
 		createNewFile(new .("zen.h", BOILERPLATE));
 
-		let headerCode = doAST(m_ast, .. scope .());
+		// Spelled out once up front (unless a compile time run already did), the section jobs only ever read the table.
+		for (let info in m_types.Types)
+		{
+			if (isSpellable(info.Type) && info.CName == null)
+				info.CName = spellType(info.Type, .. new .());
+
+			if (info.Type case .Array(let arr) && arr.SoA && *arr.Element case .Structure(let _struct))
+			{
+				if (!m_soaTypes.TryGetValue(_struct, var soaTypes))
+				{
+					soaTypes = new .();
+					m_soaTypes.Add(_struct, soaTypes);
+				}
+				soaTypes.Add(info);
+			}
+		}
 
-		let mainCode = scope StringCodeBuilder();
+		// After checking the scope tree is read-only, so every scope's sections can be generated on their own.
+		let scopes = scope List<Scope>();
+		let unitNames = scope List<String>();
+		defer unitNames.ClearAndDeleteItems();
+		collectScopes(m_globalScope, USER_SYMBOL_PREFIX, scopes, unitNames);
+		let sections = scope Sections();
+		queueSections(.NamedTypeDeclares, scopes, sections.TypeDeclares);
+		queueSections(.FunctionDeclares, scopes, sections.FunctionDeclares);
+		queueSections(.NamedTypeImpls, scopes, sections.TypeImpls);
+		queueSections(.GlobalConstants, scopes, sections.Constants);
+		queueSections(.GlobalVars(null), scopes, sections.Globals);
+		queueSections(.FunctionImpls, scopes, sections.FunctionImpls);
+		if (m_context.SplitTranslationUnits)
+			queueSections(.GlobalVarDeclares, scopes, sections.GlobalDeclares);
+		m_pool.WaitIdle();
+
+		if (m_context.SplitTranslationUnits)
+			return generateSplit(sections, unitNames);
+
+		let headerCode = doAST(sections, .. scope .());
+
+		let mainCode = new StringCodeBuilder();
 		mainCode.AppendLine("#include <zen.h>");
 		mainCode.AppendEmptyLine();
-		mainCode.AppendLine(headerCode.Code);
+		mainCode.AppendLine(headerCode);
 		mainCode.AppendEmptyLine();
-		mainCode.AppendBanner("Entry point");
-		mainCode.AppendLine(
-		scope $"""
-		void main()
-		\{
-			zencg_initglobals();
-			{USER_SYMBOL_PREFIX}_main();
-		\}
-		""");
-		let mainFile = createNewFile(new .("main.c", mainCode.Code));
+		appendEntryPoint(mainCode);
+		let mainFile = createNewFile(new .("main.c", mainCode));
 
 		return .() {
 			MainFile = mainFile,
@@ -110,38 +191,171 @@ class Generator
 		};
 	}
 
-	private void doAST(Ast ast, StringCodeBuilder headerCode)
+	/// The code one DoScopeKind produced for a single scope.
+	private class Section
 	{
-		void doScopeRecursive(DoScopeKind kind, Scope _scope, StringCodeBuilder code)
+		public readonly Scope Scope;
+		public DoScopeKind Kind;
+		public readonly StringCodeBuilder Code = new .() ~ delete _;
+		public readonly List<Entity.Variable> Globals = new .() ~ delete _;
+
+		public this(DoScopeKind kind, Scope _scope)
 		{
-			doScope(kind, _scope, code);
-			for (let entity in _scope.EntityMap)
+			this.Kind = kind;
+			this.Scope = _scope;
+		}
+	}
+
+	/// Every scope's sections, each list is in the order doScopeRecursive() would've visited the scopes.
+	private class Sections
+	{
+		public List<Section> TypeDeclares = new .() ~ DeleteContainerAndItems!(_);
+		public List<Section> FunctionDeclares = new .() ~ DeleteContainerAndItems!(_);
+		public List<Section> TypeImpls = new .() ~ DeleteContainerAndItems!(_);
+		public List<Section> Constants = new .() ~ DeleteContainerAndItems!(_);
+		public List<Section> Globals = new .() ~ DeleteContainerAndItems!(_);
+		public List<Section> GlobalDeclares = new .() ~ DeleteContainerAndItems!(_);
+		public List<Section> FunctionImpls = new .() ~ DeleteContainerAndItems!(_);
+	}
+
+	private void queueSections(DoScopeKind kind, List<Scope> scopes, List<Section> outSections)
+	{
+		for (let _scope in scopes)
+		{
+			let section = new Section(kind, _scope);
+			if (kind case .GlobalVars(?))
+				section.Kind = .GlobalVars(section.Globals);
+
+			outSections.Add(section);
+			m_pool.Enqueue(new () =>
 			{
-				if (let ns = entity.value as Entity.Namespace)
+				using (m_profiler.Begin(section.Kind.Name, "codegen", section.Scope.Name))
 				{
-					// namespaceStack.Append(scope $"_{ns.Decl.Name.Lexeme}");
-					// doScope(.NamedTypeDeclares, ns.Decl.Scope, namespaceStackStr, headerCode);
-					doScopeRecursive(kind, ns.Decl.Scope, code);
+					doScope(section.Kind, section.Scope, section.Code);
 				}
+			});
+		}
+	}
+
+	/// Stitches the sections together as if they had been generated into the same builder.
+	private void appendSections(List<Section> sections, StringCodeBuilder code, List<Entity.Variable> outVars = null)
+	{
+		for (let section in sections)
+		{
+			appendSection(section, code, outVars);
+		}
+	}
+
+	private void appendSection(Section section, StringCodeBuilder code, List<Entity.Variable> outVars = null)
+	{
+		if (!section.Code.IsEmpty)
+			code.AppendLine(section.Code);
+
+		if (outVars != null)
+			outVars.AddRange(section.Globals);
+	}
+
+	/// One translation unit per namespace, so a C compiler can build them in parallel.
+	/// zen_decls.h declares everything (types, functions, constants and the globals as extern), each namespace's .c file
+	/// defines its globals and functions, and main.c only holds the globals' initialization and the entry point.
+	private GeneratorResult generateSplit(Sections sections, List<String> unitNames)
+	{
+		let declsCode = new StringCodeBuilder();
+		declsCode.AppendLine("#pragma once");
+		declsCode.AppendLine("#include <zen.h>");
+		declsCode.AppendEmptyLine();
+		appendDeclarations(sections, declsCode);
+		declsCode.AppendBanner("Global variables");
+		appendSections(sections.GlobalDeclares, declsCode);
+		createNewFile(new .(DECLS_HEADER_NAME, declsCode));
+
+		List<Entity.Variable> outVars = scope .();
+		let usedNames = scope HashSet<StringView>();
+
+		for (let i < sections.Globals.Count)
+		{
+			let unitCode = new StringCodeBuilder();
+			unitCode.AppendLine(scope $"#include <{DECLS_HEADER_NAME}>");
+			unitCode.AppendEmptyLine();
+			unitCode.AppendBanner("Global variables");
+			appendSection(sections.Globals[i], unitCode, outVars);
+			unitCode.AppendBanner("Function implementations");
+			appendSection(sections.FunctionImpls[i], unitCode);
+
+			// Two units with the same name would overwrite each other on disk, and 'namespace a;' inside 'foo' is named
+			// the same as a top level 'foo_a', so the later one gets a number added until it's free.
+			let unitName = unitNames[i];
+			let baseLength = unitName.Length;
+			for (int suffix = 2; !usedNames.Add(unitName); suffix++)
+			{
+				unitName.RemoveToEnd(baseLength);
+				unitName.AppendF("_{}", suffix);
+			}
+
+			createNewFile(new .(scope $"{unitName}.c", unitCode));
+		}
+
+		let mainCode = new StringCodeBuilder();
+		mainCode.AppendLine(scope $"#include <{DECLS_HEADER_NAME}>");
+		mainCode.AppendEmptyLine();
+		appendInitGlobals(mainCode, outVars);
+		mainCode.AppendEmptyLine();
+		appendEntryPoint(mainCode);
+		let mainFile = createNewFile(new .("main.c", mainCode));
+
+		return .() {
+			MainFile = mainFile,
+			Files = m_outputFilesList
+		};
+	}
+
+	/// Every scope that gets code generated for it, in the same order doScopeRecursive() visits them.
+	/// outUnitNames gets the name of each scope's translation unit for '-split', the global scope's is unitName,
+	/// every namespace's is its parent's with its own name added, taken from the namespace entity that owns the scope.
+	private void collectScopes(Scope _scope, StringView unitName, List<Scope> outScopes, List<String> outUnitNames)
+	{
+		outScopes.Add(_scope);
+		outUnitNames.Add(new .(unitName));
+		for (let entity in _scope.EntityMap)
+		{
+			if (let ns = entity.value as Entity.Namespace)
+			{
+				collectScopes(ns.Decl.Scope, scope $"{unitName}_{ns.Token.Lexeme}", outScopes, outUnitNames);
 			}
 		}
+	}
 
+	private void appendDeclarations(Sections sections, StringCodeBuilder headerCode)
+	{
 		headerCode.AppendBanner("Symbol declarations");
-		doScopeRecursive(.NamedTypeDeclares, m_globalScope, headerCode);
+		appendSections(sections.TypeDeclares, headerCode);
 		headerCode.AppendBanner("Function declarations");
-		doScopeRecursive(.FunctionDeclares, m_globalScope, headerCode);
+		appendSections(sections.FunctionDeclares, headerCode);
 		headerCode.AppendBanner("Symbol implementations");
-		doScopeRecursive(.NamedTypeImpls, m_globalScope, headerCode);
+		appendSections(sections.TypeImpls, headerCode);
 		headerCode.AppendBanner("Global constants");
-		doScopeRecursive(.GlobalConstants, m_globalScope, headerCode);
+		appendSections(sections.Constants, headerCode);
+	}
+
+	private void doAST(Sections sections, StringCodeBuilder headerCode)
+	{
+		appendDeclarations(sections, headerCode);
 		headerCode.AppendBanner("Global variables");
 		List<Entity.Variable> outVars = scope .();
-		doScopeRecursive(.GlobalVars(outVars), m_globalScope, headerCode);
+		appendSections(sections.Globals, headerCode, outVars);
 
-		headerCode.AppendLine("void zencg_initglobals()");
-		headerCode.AppendLine("{");
-		headerCode.IncreaseTab();
-		for (let _var in outVars)
+		appendInitGlobals(headerCode, outVars);
+
+		headerCode.AppendBanner("Function implementations");
+		appendSections(sections.FunctionImpls, headerCode);
+	}
+
+	private void appendInitGlobals(StringCodeBuilder code, List<Entity.Variable> globals)
+	{
+		code.AppendLine(scope $"void {INIT_GLOBALS_SYMBOL}()");
+		code.AppendLine("{");
+		code.IncreaseTab();
+		for (let _var in globals)
 		{
 			// @NOTE - pelly 11/6/25
 			// Visual Studio gave a warning for this, I think we can safely ignore the initializer if it's an array as arrays don't allow initializers (yet).
@@ -150,13 +364,87 @@ class Generator
 			{
 				continue;
 			}
-			writeStmt_VarDecl(_var.Decl, headerCode, _var.Scope, false, true, true);
+			if (SkipRunInitializers && _var.Decl.Initializer != null && containsRun(_var.Decl.Initializer))
+			{
+				continue;
+			}
+			writeStmt_VarDecl(_var.Decl, code, _var.Scope, false, true, true);
 		}
-		headerCode.DecreaseTab();
-		headerCode.AppendLine("}");
+		code.DecreaseTab();
+		code.AppendLine("}");
+	}
 
-		headerCode.AppendBanner("Function implementations");
-		doScopeRecursive(.FunctionImpls, m_globalScope, headerCode);
+	/// The entry point of the program CompileTimeRunner builds, to go after everything Generate() made.
+	/// Runs the '#run' statements in order, then stores the result of every other '#run' at its index in runs,
+	/// integers and bools in ints and floats in floats. The globals have to be initialized first, like before main.
+	/// The sizes of sizedGlobals go in a table next to it, so CompileTimeRunner can tell whether they changed.
+	public CFile GenerateRunner(List<AstNode.Expression.Run> runs, List<Entity.Variable> sizedGlobals)
+	{
+		let code = new StringCodeBuilder();
+		code.AppendLine("#include <zen.h>");
+		code.AppendEmptyLine();
+
+		if (!sizedGlobals.IsEmpty)
+		{
+			code.AppendLine(scope $"const int64 {RUN_SIZES_SYMBOL}[] = \{");
+			code.IncreaseTab();
+			for (let _var in sizedGlobals)
+			{
+				code.AppendLine(scope $"sizeof({GetGlobalName(_var, .. scope .())}),");
+			}
+			code.DecreaseTab();
+			code.AppendLine("};");
+			code.AppendEmptyLine();
+		}
+
+		code.AppendLine(scope $"void {RUN_SYMBOL}(int64* ints, double* floats)");
+		code.AppendLine("{");
+		code.IncreaseTab();
+
+		for (let run in runs)
+		{
+			if (!run.IsStatement)
+				continue;
+
+			code.AppendNewLine();
+			code.AppendTabs();
+			emitExpr(run.Value, code, run.Scope);
+			code.Append(';');
+		}
+
+		for (let run in runs)
+		{
+			if (run.IsStatement)
+				continue;
+
+			code.AppendNewLine();
+			code.AppendTabs();
+			if (run.ResolvedType.IsTypeFloat())
+				code.Append(scope $"floats[{@run.Index}] = (double)(");
+			else
+				code.Append(scope $"ints[{@run.Index}] = (int64)(");
+			emitExpr(run.Value, code, run.Scope);
+			code.Append(");");
+		}
+
+		code.DecreaseTab();
+		code.AppendLine("}");
+
+		return createNewFile(new .(RUN_FILE_NAME, code));
+	}
+
+	private void appendEntryPoint(StringCodeBuilder code)
+	{
+		code.AppendBanner("Entry point");
+		code.AppendLine(
+		scope $"""
+		int main(void)
+		\{
+			{INIT_GLOBALS_SYMBOL}();
+			{USER_SYMBOL_PREFIX}_main();
+			return 0;
+		\}
+		""");
 	}
 
 	enum DoScopeKind
@@ -166,15 +454,33 @@ class Generator
 		case NamedTypeImpls;
 		case GlobalConstants;
 		case GlobalVars(List<Entity.Variable> outVars);
+		case GlobalVarDeclares;
 		case FunctionImpls;
+
+		public StringView Name
+		{
+			get
+			{
+				switch (this)
+				{
+				case .NamedTypeDeclares: return "NamedTypeDeclares";
+				case .FunctionDeclares:  return "FunctionDeclares";
+				case .NamedTypeImpls:    return "NamedTypeImpls";
+				case .GlobalConstants:   return "GlobalConstants";
+				case .GlobalVars:        return "GlobalVars";
+				case .GlobalVarDeclares: return "GlobalVarDeclares";
+				case .FunctionImpls:     return "FunctionImpls";
+				}
+			}
+		}
 	}
 
-	private void buildNamespaceString(IEntityNamespaceParent entity, String outStr, bool zenPrefix)
+	private static void buildNamespaceString(IEntityNamespaceParent entity, String outStr, bool zenPrefix)
 	{
 		buildNamespaceString(entity.NamespaceParent, outStr, zenPrefix);
 	}
 
-	private void buildNamespaceString(Entity.Namespace _namespace, String outStr, bool zenPrefix)
+	private static void buildNamespaceString(Entity.Namespace _namespace, String outStr, bool zenPrefix)
 	{
 		if (zenPrefix)
 		{
@@ -187,12 +493,81 @@ class Generator
 		}
 	}
 
+	/// What a global variable is called in the generated C, the same as writeStmt_VarDecl() spells it.
+	public static void GetGlobalName(Entity.Variable _var, String outName)
+	{
+		buildNamespaceString(_var, outName, true);
+		outName.Append('_');
+		outName.Append(_var.Decl.Name.Lexeme);
+	}
+
+	/// Whether there's a '#run' anywhere in there.
+	private static bool containsRun(AstNode.Expression expr)
+	{
+		switch (expr.GetKind())
+		{
+		case .Run:
+			return true;
+		case .Binary(let bin):
+			return containsRun(bin.Left) || containsRun(bin.Right);
+		case .Logical(let log):
+			return containsRun(log.Left) || containsRun(log.Right);
+		case .Unary(let un):
+			return containsRun(un.Right);
+		case .Grouping(let group):
+			return containsRun(group.Expression);
+		case .Cast(let cast):
+			return containsRun(cast.Value);
+		case .Index(let index):
+			return containsRun(index.Array) || containsRun(index.Index);
+		case .Get(let get):
+			return containsRun(get.Object);
+		case .Call(let call):
+			for (let arg in call.Arguments)
+			{
+				if (containsRun(arg))
+					return true;
+			}
+			return false;
+		case .CompositeLiteral(let composite):
+			for (let element in composite.Elements)
+			{
+				if (containsRun(element))
+					return true;
+			}
+			return false;
+		default:
+			return false;
+		}
+	}
+
+	/// Enum values stay spelled out by name, the C enum already holds their value.
+	private static bool isEnumValue(AstNode.Expression expr)
+	{
+		var name = expr;
+		if (let qn = expr as AstNode.Expression.QualifiedName)
+			name = qn.Right;
+
+		if (let _var = name as AstNode.Expression.Variable)
+		{
+			if (let constant = _var.ResolvedEntity as Entity.Constant)
+				return constant.Decl case .EnumField;
+		}
+		return false;
+	}
+
+	/// Without a Reachability pass (-keepdead) everything gets generated.
+	private bool isLive(Entity entity) => m_reachability == null || m_reachability.IsLive(entity);
+
 	private void doScope(DoScopeKind kind, Scope _scope, StringCodeBuilder code)
 	{
 		if (kind == .NamedTypeDeclares)
 		{
 			for (let entity in _scope.EntityMap)
 			{
+				if (!isLive(entity.value))
+					continue;
+
 				switch (entity.value.GetKind())
 				{
 				case .TypeName(let typename):
@@ -205,6 +580,12 @@ class Generator
 
 						let name = scope $"{namespaceStr}_{_struct.Name.Lexeme}";
 						code.AppendLine(scope $"typedef struct {name} {name};");
+
+						if (m_soaTypes.TryGetValue(_struct, let soaTypes))
+						{
+							for (let info in soaTypes)
+								code.AppendLine(scope $"typedef struct {info.CName} {info.CName};");
+						}
 						break;
 					case .EnumDecl(let _enum):
 						if (_enum.Kind == .Extern)
@@ -241,6 +622,9 @@ class Generator
 		{
 			for (let entity in _scope.EntityMap)
 			{
+				if (!isLive(entity.value))
+					continue;
+
 				switch (entity.value.GetKind())
 				{
 				case .Function(let funEnt):
@@ -262,6 +646,9 @@ class Generator
 		{
 			for (let entity in _scope.EntityMap)
 			{
+				if (!isLive(entity.value))
+					continue;
+
 				switch (entity.value.GetKind())
 				{
 				case .TypeName(let typename):
@@ -296,6 +683,7 @@ class Generator
 
 									code.Append(writeResolvedType(val.ResolvedType, .. scope .()));
 									code.Append(scope $" {field.Name.Lexeme}");
+									code.Append(appendArraySuffix(val.ResolvedType, .. scope .()));
 
 									// @NOTE - pelly 11/5/25
 									// C doesn't allow for struct initializers, so we'll need to do this later.
@@ -318,6 +706,12 @@ class Generator
 						code.DecreaseTab();
 						code.AppendLine("};"); // <- Yah, struct implementations need semicolons for TinyCC:
 											   // https://lists.gnu.org/archive/html/tinycc-devel/2008-09/msg00033.html
+
+						if (m_soaTypes.TryGetValue(_struct, let soaTypes))
+						{
+							for (let info in soaTypes)
+								appendSoAStruct(_struct, info, code);
+						}
 						break;
 					default:
 					}
@@ -331,6 +725,9 @@ class Generator
 		{
 			for (let entity in _scope.EntityMap)
 			{
+				if (!isLive(entity.value))
+					continue;
+
 				if (let constant = entity.value as Entity.Constant)
 				{
 					// This means it's a built in constant, so like int32s and stuff. We can safely ignore those as they're defined in the zen.h header.
@@ -346,12 +743,18 @@ class Generator
 		{
 			for (let entity in _scope.EntityMap)
 			{
+				if (!isLive(entity.value))
+					continue;
+
 				switch (entity.value.GetKind())
 				{
 				case .Variable(let ent):
 					// It might be okay to do this here?
 					// For variables at the global (or non functional) scope at least...?
-					writeStmt_VarDecl(ent.Decl, code, _scope, true, false, true);
+					writeStmt_VarDecl(ent.Decl, code, _scope, true, false, false);
+					if (BakedGlobals != null && BakedGlobals.TryGetValue(ent, let baked))
+						code.Append(scope $" = {baked}");
+					code.Append(';');
 					outVars.Add(ent);
 					break;
 				default:
@@ -359,10 +762,29 @@ class Generator
 			}
 		}
 
+		if (kind == .GlobalVarDeclares)
+		{
+			for (let entity in _scope.EntityMap)
+			{
+				if (!isLive(entity.value))
+					continue;
+
+				if (let ent = entity.value as Entity.Variable)
+				{
+					let decl = scope StringCodeBuilder();
+					writeStmt_VarDecl(ent.Decl, decl, _scope, true, false, true);
+					code.AppendLine(scope $"extern {decl.Code}");
+				}
+			}
+		}
+
 		if (kind == .FunctionImpls)
 		{
 			for (let entity in _scope.EntityMap)
 			{
+				if (!isLive(entity.value))
+					continue;
+
 				switch (entity.value.GetKind())
 				{
 				case .Function(let entity):
@@ -373,6 +795,9 @@ class Generator
 						break;
 
 					let namespaceStr = buildNamespaceString(entity, .. scope .(), true);
+					let zone = m_profiler.Begin("Function", "codegen", fun.Name.Lexeme);
+					zone.Count("statements", fun.Body.List.Count);
+
 					appendFunctionHead(fun, namespaceStr, code);
 					code.AppendLine("{");
 					code.IncreaseTab();
@@ -384,6 +809,8 @@ class Generator
 					}
 					code.DecreaseTab();
 					code.AppendLine("}");
+
+					zone.Dispose();
 					break;
 				default:
 				}
@@ -464,6 +891,16 @@ class Generator
 			break;
 
 		case .If(let _if):
+			// Only the branch that can run is generated when the condition folded.
+			if (_if.Condition.Folded != null && _if.Condition.Folded.Value case .Bool(let alwaysTrue))
+			{
+				if (alwaysTrue)
+					emitFunctionStmt(_if.ThenBranch, code, _if.ThenBranch.Scope);
+				else if (_if.ElseBranch case .Ok(let _else))
+					emitFunctionStmt(_else, code, _else.Scope);
+				break;
+			}
+
 			let condition = emitExpr(_if.Condition, .. scope .(), _if.ThenBranch.Scope);
 			code.AppendLine(scope $"if ({condition.Code})");
 			emitFunctionStmt(_if.ThenBranch, code, _if.ThenBranch.Scope);
@@ -490,8 +927,28 @@ class Generator
 			if (_for.Updation != null) body.Append(' ');
 			emitExpr(_for.Updation, body, _for.Scope);
 
+			// The loop's end is known by now, so everything the body indexes with the counter gets checked in one go.
+			let hoisted = m_context.BoundsChecks && _for.HoistedBoundsCount != AstNode.Stmt.For.NO_HOISTED_BOUNDS;
+			if (hoisted)
+			{
+				let condition = _for.Condition as AstNode.Expression.Binary;
+				let end = emitExpr(condition.Right, .. scope .(), _for.Scope);
+				if (condition.Op.Kind == .LessEqual)
+					end.Append(" + 1");
+
+				code.AppendLine("{");
+				code.IncreaseTab();
+				code.AppendLine(scope $"zen_bounds_check_loop({_for.HoistedBoundsStart}, (int64)({end.Code}), {_for.HoistedBoundsStep}, {_for.HoistedBoundsCount});");
+			}
+
 			code.AppendLine(scope $"for ({body.Code})");
 			emitFunctionStmt(_for.Body, code, _for.Scope);
+
+			if (hoisted)
+			{
+				code.DecreaseTab();
+				code.AppendLine("}");
+			}
 			break;
 
 		case .While(let _while):
@@ -510,7 +967,73 @@ class Generator
 		}
 	}
 
+	/// An array of the struct's fields, each one as long as the array, so 'a[i].x' is 'a.x[i]'.
+	private void appendSoAStruct(AstNode.Stmt.StructDeclaration _struct, TypeTable.TypeInfo info, StringCodeBuilder code)
+	{
+		Runtime.Assert(info.Type case .Array(let arr));
+
+		code.AppendLine(scope $"struct {info.CName} \{");
+		code.IncreaseTab();
+		{
+			for (let field in _struct.Fields)
+			{
+				let fieldEntity = _struct.Scope.LookupStmtAs<Entity.Variable>(field).Value;
+
+				code.AppendNewLine();
+				code.AppendTabs();
+				code.Append(writeResolvedType(fieldEntity.ResolvedType, .. scope .()));
+				code.Append(scope $" {field.Name.Lexeme}[{arr.Count}]");
+				code.Append(appendArraySuffix(fieldEntity.ResolvedType, .. scope .()));
+				code.Append(';');
+			}
+		}
+		code.DecreaseTab();
+		code.AppendLine("};");
+	}
+
+	/// C puts an array's sizes after the name instead of on the type. A struct of arrays is a struct in C, its count is part of its name.
+	private static void appendArraySuffix(ZenType type, String outStr)
+	{
+		if (type case .Array(let arr) && !arr.SoA)
+		{
+			appendArraySuffix(*arr.Element, outStr);
+			outStr.Append(scope $"[{arr.Count}]");
+		}
+	}
+
 	private void writeResolvedType(ZenType type, String outStr)
+	{
+		if (type case .Basic(let basic))
+		{
+			outStr.Append(basic.Name);
+			return;
+		}
+
+		if (m_types.Find(type) case .Ok(let info) && info.CName != null)
+		{
+			outStr.Append(info.CName);
+			return;
+		}
+
+		spellType(type, outStr);
+	}
+
+	private static bool isSpellable(ZenType type)
+	{
+		switch (type)
+		{
+		case .Basic, .Structure, .Enum:
+			return true;
+		case .Pointer(let ptr):
+			return isSpellable(*ptr.Element);
+		case .Array(let arr):
+			return isSpellable(*arr.Element);
+		default:
+			return false;
+		}
+	}
+
+	private void spellType(ZenType type, String outStr)
 	{
 		switch (type)
 		{
@@ -562,14 +1085,39 @@ class Generator
 			// Arrays are next to the name and not the type.
 			// So we can just ignore this.
 			writeResolvedType(*arr.Element, outStr);
+
+			// Unless it's a struct of arrays, that one's its own struct.
+			if (arr.SoA)
+				outStr.Append(scope $"_soa{arr.Count}");
 			break;
 		default:
 			Runtime.Assert(false);
 		}
 	}
 
+	/// The '[i]' part of an array access, wrapped in a check when the build has them and the Checker couldn't prove it's in bounds.
+	private void emitIndex(AstNode.Expression.Index index, StringCodeBuilder code, Scope _scope)
+	{
+		let check = m_context.BoundsChecks && index.Bounds == .Inline;
+
+		code.Append('[');
+		if (check)
+			code.Append("zen_bounds_check(");
+		emitExpr(index.Index, code, _scope);
+		if (check)
+			code.Append(scope $", {index.BoundsCount})");
+		code.Append(']');
+	}
+
 	private void emitExpr(AstNode.Expression expr, StringCodeBuilder code, Scope _scope, bool zenNamespacePrefix = true, EmitExprParameters parameters = default)
 	{
+		// The Checker already worked out the value, so TinyCC doesn't have to do the math at runtime.
+		if (expr.Folded != null && !(expr is AstNode.Expression.Literal) && !isEnumValue(expr))
+		{
+			code.Append(expr.Folded.Value.ToC(.. scope .()));
+			return;
+		}
+
 		switch (expr.GetKind())
 		{
 		case .Binary(let bin):
@@ -579,7 +1127,12 @@ class Generator
 			break;
 
 		case .Variable(let _var):
-			let entity = _scope.LookupName(_var.Name.Lexeme);
+			// The right side of a qualified name was resolved in the namespace's scope, not in this one.
+			Result<Entity> entity = .Err;
+			if (zenNamespacePrefix && _var.ResolvedEntity != null)
+				entity = .Ok(_var.ResolvedEntity);
+			else
+				entity = _scope.LookupName(_var.Name.Symbol);
 			if (entity case .Ok(let val))
 			{
 				if (let _constEnt = val as Entity.Constant)
@@ -650,21 +1203,11 @@ class Generator
 
 					// @TODO
 					// Support non-primitive types.
-					let printArg = call.Arguments[0];
-					ZenType argType = ?;
-					if (printArg.GetKind() case .Literal(let lit))
-					{
-						argType = lit.GetLiteralType();
-					}
-					else if (printArg.GetKind() case .Variable(let _var))
-					{
-						let entity = _scope.LookupName(_var.Name.Lexeme).Value as Entity.Variable;
-						argType = entity.ResolvedType;
-					}
-					else
+					if (call.ResolvedArgumentType == null)
 					{
 						Runtime.FatalError("Can't convert this type! :(");
 					}
+					let argType = call.ResolvedArgumentType.Value;
 
 					if (argType.IsTypeInteger())
 					{
@@ -721,7 +1264,7 @@ class Generator
 			{
 				// @FIX
 				// I don't think the codegen should have to do this
-				let entity = _scope.LookupName(call.Callee.Name.Lexeme);
+				let entity = _scope.LookupName(call.Callee.Name.Symbol);
 				if (entity case .Ok(let found))
 				{
 					if (let t = found as IEntityNamespaceParent)
@@ -800,6 +1343,18 @@ class Generator
 			break;
 
 		case .Get(let get):
+			// The other way around for a struct of arrays, the field is the array.
+			if (let index = get.Object as AstNode.Expression.Index)
+			{
+				if (index.IsSoA)
+				{
+					emitExpr(index.Array, code, _scope);
+					code.Append(scope $".{get.Name.Lexeme}");
+					emitIndex(index, code, _scope);
+					break;
+				}
+			}
+
 			emitExpr(get.Object, code, _scope);
 
 			bool isPointer = get.IsPointer;
@@ -838,13 +1393,13 @@ class Generator
 			// The checker should resolve all this, I'm tired of looking back up scopes to find this data...
 			if (let call = qn.Right as AstNode.Expression.Call)
 			{
-				let lookForScopeResult = _scope.LookupName(qn.Left.Lexeme);
+				let lookForScopeResult = _scope.LookupName(qn.Left.Symbol);
 
 				if (lookForScopeResult case .Ok(let leftFound))
 				{
 					if (let foundScope = leftFound as Entity.Namespace)
 					{
-						let callRes = foundScope.Decl.Scope.LookupName(call.Callee.Name.Lexeme);
+						let callRes = foundScope.Decl.Scope.LookupName(call.Callee.Name.Symbol);
 						if (callRes case .Ok(let found))
 						{
 							if (let fun = found as Entity.Function)
@@ -869,7 +1424,7 @@ class Generator
 
 				// @FIX
 				// I don't think the codegen should have to do this
-				let entity = _scope.LookupName(qn.Left.Lexeme);
+				let entity = _scope.LookupName(qn.Left.Symbol);
 				if (entity case .Ok(let found))
 				{
 					if (let typename = found as Entity.TypeName)
@@ -912,9 +1467,7 @@ class Generator
 
 		case .Index(let index):
 			emitExpr(index.Array, code, _scope);
-			code.Append('[');
-			emitExpr(index.Index, code, _scope);
-			code.Append(']');
+			emitIndex(index, code, _scope);
 			break;
 
 		case .CompositeLiteral(let composite):
@@ -943,6 +1496,11 @@ class Generator
 			code.Append(inlined.Code);
 			code.Append(scope $"/*End inline C*/");
 			break;
+
+		case .Run(let run):
+			// Only for the program CompileTimeRunner runs, after that it's folded.
+			emitExpr(run.Value, code, _scope);
+			break;
 		}
 	}
 
@@ -38,7 +38,13 @@ extension Generator
 			code.Append(scope $"[{arr.Count}]");
 		}
 
-		if (decl.Initializer != null)
+		if (constant.Value != null)
+		{
+			// Already converted to the constant's type.
+			code.Append(' ');
+			code.Append(constant.Value.Value.ToC(.. scope .()));
+		}
+		else if (decl.Initializer != null)
 		{
 			code.Append(' ');
 
@@ -94,19 +100,7 @@ extension Generator
 		// Write name
 		code.Append(v.Name.Lexeme);
 
-		void writeArray(ArrayType arr)
-		{
-			if (*arr.Element case .Array(let elementArr))
-			{
-				writeArray(elementArr);
-			}
-			code.Append(scope $"[{arr.Count}]");
-		}
-
-		if (entity.ResolvedType case .Array(let arr))
-		{
-			writeArray(arr);
-		}
+		code.Append(appendArraySuffix(entity.ResolvedType, .. scope .()));
 
 		if (writeInitializer)
 		{
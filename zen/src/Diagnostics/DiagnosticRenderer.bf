@@ -12,38 +12,40 @@ public class DiagnosticRenderer
 		this.m_CodeColor = codeColor;
 	}
 
-	public void WriteError(Dictionary<SourceFileID, SourceFile> fileIDs, Diagnostic diagnostic)
+	public void WriteError(SourceManager sources, Diagnostic diagnostic)
 	{
-		Console.ForegroundColor = .Red;
+		let color = (diagnostic.Level == .Warning) ? ConsoleColor.Yellow : ConsoleColor.Red;
+		Console.ForegroundColor = color;
 		defer { Console.ForegroundColor = m_CodeColor; }
 
-		Console.Write(scope $"ERROR: ");
+		Console.Write((diagnostic.Level == .Warning) ? "WARNING: " : "ERROR: ");
 		Console.WriteLine(scope $"{diagnostic.Message}");
 
 		for (let span in diagnostic.Spans)
 		{
-			let file = fileIDs[span.Range.Start.File];
-			let line = file.Lines[span.Range.Start.Line];
+			let file = sources.GetFile(span.Range.Start).Value;
+			let (lineIndex, column) = file.GetLineColumn(span.Range.Start);
+			let line = file.GetLine(lineIndex);
 
-			let lineNumStr = (span.Range.Start.Line + 1).ToString(.. scope .());
+			let lineNumStr = (lineIndex + 1).ToString(.. scope .());
 
 			Console.ForegroundColor = .Cyan;
-			Console.WriteLine(scope $" --> {file.Name}:{span.Range.Start.Line + 1}:{span.Range.Start.Column + 1}");
+			Console.WriteLine(scope $" --> {file.Name}:{lineIndex + 1}:{column + 1}");
 
 			Console.ForegroundColor = m_CodeColor;
 			Console.WriteLine(writeStringWithNumberBar(lineNumStr, line, .. scope .()));
 
-			Console.ForegroundColor = .Red;
+			Console.ForegroundColor = color;
 			defer { Console.ForegroundColor = m_CodeColor; }
 
 			/*
-			let space = scope String(' ', span.Range.Start.Column);
-			let arrow = scope String('^', span.Range.End.Offset - span.Range.Start.Offset);
+			let space = scope String(' ', column);
+			let arrow = scope String('^', span.Range.Length);
 			Console.WriteLine(scope $"{space} {arrow}");
 			*/
 
 			let arrowLine = scope String();
-			for (let i < span.Range.Start.Column)
+			for (let i < column)
 			{
 				// I hate that I have to do this lol....
 				// Think about what it could've been:
@@ -60,7 +62,7 @@ public class DiagnosticRenderer
 					break;
 				}
 			}
-			arrowLine.Append('^', span.Range.End.Offset - span.Range.Start.Offset);
+			arrowLine.Append('^', span.Range.Length);
 			let pad = scope String()..PadLeft(lineNumStr.Length);
 			Console.WriteLine(writeStringWithNumberBar(pad, arrowLine, .. scope .()));
 		}
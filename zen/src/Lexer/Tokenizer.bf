@@ -5,50 +5,152 @@ namespace Zen;
 
 class Tokenizer
 {
+	/// Emits a perfect hash table of the keywords: every keyword gets its own slot, so a lookup is one hash and one compare.
+	/// Searches for the smallest table (and hash multiplier) that works, so adding a keyword to TokenKind just works.
 	[Comptime, OnCompile(.TypeInit)]
 	private static void Process()
 	{
-		let t = scope String();
-		t.Append("private static readonly Dictionary<StringView, TokenKind> s_keywordsMap = new .()");
-		t.Append("\n{");
+		let lexemes = scope List<String>();
+		let kinds = scope List<String>();
+		defer { lexemes.ClearAndDeleteItems(); kinds.ClearAndDeleteItems(); }
 
 		for (let field in Enum.GetEnumerator<TokenKind>())
 		{
 			if (field.value.GetKeyword() case .Ok(let keyword))
 			{
-				t.Append("\n\t");
-				t.Append(scope $"""
-					("{keyword.Lexeme}", .{field.value}),
-					""");
+				lexemes.Add(new .(keyword.Lexeme));
+				kinds.Add(field.value.ToString(.. new .()));
 			}
 		}
 
-		t.Append("\n} ~ delete _;");
+		int size = 16;
+		uint32 multiplier = 0;
+		let slots = scope List<int>();
+		search: while (true)
+		{
+			for (uint32 candidate = 1; candidate < 1024; candidate++)
+			{
+				slots.Clear();
+				for (let i < size)
+					slots.Add(-1);
+
+				bool perfect = true;
+				for (let i < lexemes.Count)
+				{
+					let slot = keywordHash(lexemes[i], candidate, size);
+					if (slots[slot] != -1)
+					{
+						perfect = false;
+						break;
+					}
+					slots[slot] = i;
+				}
+
+				if (perfect)
+				{
+					multiplier = candidate;
+					break search;
+				}
+			}
+
+			size *= 2;
+		}
+
+		let t = scope String();
+		t.Append(scope $"private const int KEYWORD_TABLE_SIZE = {size};\n");
+		t.Append(scope $"private const uint32 KEYWORD_HASH_MULTIPLIER = {multiplier};\n");
+
+		t.Append("private static readonly StringView[KEYWORD_TABLE_SIZE] s_keywordLexemes = .(");
+		for (let i < size)
+		{
+			if (i > 0)
+				t.Append(", ");
+			if (slots[i] == -1)
+				t.Append("\"\"");
+			else
+				t.AppendF("\"{}\"", lexemes[slots[i]]);
+		}
+		t.Append(");\n");
+
+		t.Append("private static readonly TokenKind[KEYWORD_TABLE_SIZE] s_keywordKinds = .(");
+		for (let i < size)
+		{
+			if (i > 0)
+				t.Append(", ");
+			if (slots[i] == -1)
+				t.Append(".Identifier");
+			else
+				t.AppendF(".{}", kinds[slots[i]]);
+		}
+		t.Append(");");
 
 		Compiler.EmitTypeBody(typeof(Self), t);
 	}
 
+	private const uint8 CLASS_WHITESPACE = 1;
+	private const uint8 CLASS_ALPHA = 2;
+	private const uint8 CLASS_DIGIT = 4;
+	private const uint8 CLASS_ALPHANUMERIC = CLASS_ALPHA | CLASS_DIGIT;
+
+	/// For findByte(), a byte's value in every lane of a word and each lane's high bit.
+	private const uint64 ONES = 0x0101010101010101UL;
+	private const uint64 HIGHS = 0x8080808080808080UL;
+
+	/// What every byte can be, so the hot loops are a table lookup per character instead of a chain of compares.
+	private static uint8[256] s_charClasses;
+
+	static this()
+	{
+		for (let i < 256)
+		{
+			let c = (char8)i;
+
+			uint8 charClass = 0;
+			if (c == ' ' || c == '\t' || c == '\r' || c == '\n')
+				charClass |= CLASS_WHITESPACE;
+			if (c.IsLetter || c == '_')
+				charClass |= CLASS_ALPHA;
+			if (c.IsDigit)
+				charClass |= CLASS_DIGIT;
+
+			s_charClasses[i] = charClass;
+		}
+	}
+
 	private readonly List<Token> m_tokens = new .() ~ delete _;
 
+	/// Identifiers this file already interned, so only the first use of a name has to go through the shared interner.
+	private readonly Dictionary<StringView, SymbolID> m_symbols = new .() ~ delete _;
+
 	private int m_start = 0;
 	private int m_current = 0;
-	private int m_line = 0;
-	private int m_column = 0;
 
-	private readonly SourceFileID m_file;
+	/// Where the file starts in the SourceManager's offset space, lines and columns are worked out later when needed.
+	private readonly uint32 m_baseOffset;
 
 	private readonly StringView m_source;
+	private readonly uint8* m_bytes;
+	private readonly int m_length;
 
-	public this(StringView source, SourceFileID file)
+	public this(SourceFile file)
 	{
-		this.m_source = source;
-		this.m_file = file;
+		this.m_source = file.Content;
+		this.m_bytes = (uint8*)m_source.Ptr;
+		this.m_length = m_source.Length;
+		this.m_baseOffset = file.BaseOffset;
 	}
 
 	public List<Token> Run()
 	{
-		while (!isAtEnd())
+		// Code averages a token every five or so bytes, reserving up front saves growing the list over and over.
+		m_tokens.Reserve(m_length / 5 + 1);
+
+		while (true)
 		{
+			skipWhitespace();
+			if (isAtEnd())
+				break;
+
 			// We are at the beginning of the next lexeme.
 			m_start = m_current;
 			scanNextToken();
@@ -58,17 +160,11 @@ class Tokenizer
 		return m_tokens;
 	}
 
-	private void scanNextToken(params char8[] ignore)
+	private void scanNextToken()
 	{
 		let c = peek();
 		advance();
 
-		for (let char in ignore)
-		{
-			if (c == char)
-				return;
-		}
-
 		switch (c)
 		{
 		case '(' : addToken(.LeftParen); break;
@@ -82,7 +178,7 @@ class Tokenizer
 		case ';' : addToken(.Semicolon); break;
 		case '?' : addToken(.Question); break;
 		case '&' : addToken(match('&', true) ? .And : .Ampersand); break;
-		case '|' : addToken(match('|', true) ? .Or : .Ampersand); break;
+		case '|' : addToken(match('|', true) ? .Or : .VerticalBar); break;
 		case '+' : addToken(match('=', true) ? .PlusEqual : .Plus); break;
 		case '-' : addToken(match('=', true) ? .MinusEqual : .Minus); break;
 		case '*' : addToken(match('=', true) ? .StarEqual : .Star); break;
@@ -92,12 +188,7 @@ class Tokenizer
 		case '<' : addToken(match('=', true) ? .LessEqual : .Less); break;
 		case '>' : addToken(match('=', true) ? .GreaterEqual : .Greater); break;
 		case '#' :
-			if (isDigit(peek()))
-			{
-				// @ERROR
-				// Unexpected character error.
-			}
-			else if (isAlpha(peek()))
+			if (isAlpha(peek()))
 			{
 				scanIdentifier(true);
 			}
@@ -111,51 +202,11 @@ class Tokenizer
 			if (match('/', true))
 			{
 				// A comment goes until the end of the line.
-				while (peek() != '\n' && !isAtEnd()) advance();
+				m_current = findByte(m_current, '\n', '\n');
 			}
 			else if (match('*', true))
 			{
-				int depth = 1;
-
-				// Walks over a multi-line comment, it increments the line number each time a new line break is found and ignores
-				// every sequence of characters contained in the comment. The common execution of the scanner takes place
-				// once the '*/' characters are found.
-				while (!isAtEnd())
-				{
-					let cc = peek();
-
-					if (cc == '\n')
-					{
-						increaseLine();
-						advance();
-						continue;
-					}
-
-					// New nested block comment
-					if (cc == '/' && peekNext() == '*')
-					{
-						advance(); // consume '/'
-						advance(); // consume '*'
-						depth++;
-						continue;
-					}
-
-					// Closing a block comment level
-					if (cc == '*' && peekNext() == '/')
-					{
-						advance(); // consume '*'
-						advance(); // consume '/'
-						depth--;
-						if (depth == 0) return; // Finished the whole comment
-						continue;
-					}
-
-					// Any other char inside the comment
-					advance();
-				}
-
-				// @ERROR
-				// Unterminated block comment
+				scanBlockComment();
 			}
 			else if (match('=', true))
 			{
@@ -166,7 +217,7 @@ class Tokenizer
 				addToken(.ForwardSlash);
 			}
 			break;
-			case ':':
+		case ':':
 			if (match(':', true))
 			{
 				addToken(.DoubleColon);
@@ -177,19 +228,6 @@ class Tokenizer
 			}
 			break;
 
-		case ' ':
-		case '\r':
-			// Ignore white-space.
-			break;
-		case '\t':
-			// Ignore white-space.
-			// m_column += 3;
-			break;
-
-		case '\n':
-			increaseLine();
-			break;
-
 		case '"':
 			scanString();
 			break;
@@ -216,9 +254,10 @@ class Tokenizer
 		}
 	}
 
+	[Inline]
 	private bool isAtEnd()
 	{
-		return m_current >= m_source.Length;
+		return m_current >= m_length;
 	}
 
 	private StringView substring(int start, int end)
@@ -226,68 +265,71 @@ class Tokenizer
 		return m_source.Substring(start, end - start);
 	}
 
-	private void addToken(TokenKind type)
+	private SourceLocation startLocation()
 	{
-		m_tokens.Add(.(type, substring(m_start, m_current), m_line, m_column - (m_current - m_start), m_current, m_file));
-		// addToken(type/*, getValue()*/);
+		return .(m_baseOffset + (uint32)m_start);
 	}
 
-	private void addToken(TokenKind type, StringView lexeme)
+	private void addToken(TokenKind type)
 	{
-		m_tokens.Add(.(type, lexeme, m_line, m_column - (m_current - m_start), m_current, m_file));
+		m_tokens.Add(.(type, substring(m_start, m_current), startLocation(), StringInterner.INVALID));
 	}
 
-	private void increaseLine()
+	private void addToken(TokenKind type, StringView lexeme)
 	{
-		m_line++;
-		m_column = 0;
+		m_tokens.Add(.(type, lexeme, startLocation(), StringInterner.INVALID));
 	}
 
-	private bool isAlpha(char8 c)
+	private void addIdentifierToken(StringView lexeme)
 	{
-		return c.IsLetter || c == '_';
+		SymbolID symbol;
+		if (!m_symbols.TryGetValue(lexeme, out symbol))
+		{
+			symbol = StringInterner.Global.Intern(lexeme);
+			m_symbols.Add(lexeme, symbol);
+		}
+
+		m_tokens.Add(.(.Identifier, lexeme, startLocation(), symbol));
 	}
 
-	private bool isAlphaNumeric(char8 c)
+	[Inline]
+	private static bool isAlpha(char8 c)
 	{
-		return isAlpha(c) || isDigit(c);
+		return (s_charClasses[(uint8)c] & CLASS_ALPHA) != 0;
 	}
 
-	private bool isDigit(char8 c)
+	[Inline]
+	private static bool isDigit(char8 c)
 	{
-		return c.IsDigit;
+		return (s_charClasses[(uint8)c] & CLASS_DIGIT) != 0;
 	}
 
 	/// Moves the character in the text forward by 'count'.
+	[Inline]
 	private void advance(int count = 1)
 	{
 		m_current += count;
-		m_column += count;
-	}
-
-	private char8 previous(int backwards = 1)
-	{
-		return m_source[m_current - backwards];
 	}
 
 	/// Returns the current character in the text.
+	[Inline]
 	private char8 peek()
 	{
 		if (isAtEnd()) return '\0';
-		return m_source[m_current];
+		return (char8)m_bytes[m_current];
 	}
 
 	/// Returns the next character in the text.
 	private char8 peekNext(int forwards = 1)
 	{
-		if (m_current + forwards >= m_source.Length) return '\0';
-		return m_source[m_current + forwards];
+		if (m_current + forwards >= m_length) return '\0';
+		return (char8)m_bytes[m_current + forwards];
 	}
 
 	private bool match(char8 expected, bool advance)
 	{
 		if (isAtEnd()) return false;
-		if (m_source[m_current] != expected) return false;
+		if (m_bytes[m_current] != (uint8)expected) return false;
 
 		if (advance)
 		{
@@ -296,6 +338,88 @@ class Tokenizer
 		return true;
 	}
 
+	/// Moves past every character that has any of the given class bits.
+	[Inline]
+	private void skipClass(uint8 charClass)
+	{
+		var i = m_current;
+		while (i < m_length && (s_charClasses[m_bytes[i]] & charClass) != 0)
+			i++;
+		m_current = i;
+	}
+
+	private void skipWhitespace()
+	{
+		skipClass(CLASS_WHITESPACE);
+	}
+
+	/// Index of the next 'a' or 'b' at or after 'start', or the end of the source.
+	/// Checks eight bytes at a time (a zero byte in 'word ^ pattern' is a match), since comments and strings are long runs
+	/// where the only thing that matters is where they stop.
+	private int findByte(int start, char8 a, char8 b)
+	{
+		let patternA = ONES * (uint8)a;
+		let patternB = ONES * (uint8)b;
+
+		var i = start;
+		while (i + 8 <= m_length)
+		{
+			uint64 word = ?;
+			Internal.MemCpy(&word, m_bytes + i, 8);
+
+			let xa = word ^ patternA;
+			let xb = word ^ patternB;
+			if (((((xa - ONES) & ~xa) | ((xb - ONES) & ~xb)) & HIGHS) != 0)
+				break;
+
+			i += 8;
+		}
+
+		while (i < m_length && m_bytes[i] != (uint8)a && m_bytes[i] != (uint8)b)
+			i++;
+
+		return i;
+	}
+
+	/// Walks over a (possibly nested) block comment, only stopping at the characters that could open or close one.
+	private void scanBlockComment()
+	{
+		int depth = 1;
+
+		while (true)
+		{
+			m_current = findByte(m_current, '/', '*');
+			if (isAtEnd())
+			{
+				// @ERROR
+				// Unterminated block comment
+				return;
+			}
+
+			let cc = peek();
+
+			// New nested block comment
+			if (cc == '/' && peekNext() == '*')
+			{
+				advance(2);
+				depth++;
+				continue;
+			}
+
+			// Closing a block comment level
+			if (cc == '*' && peekNext() == '/')
+			{
+				advance(2);
+				depth--;
+				if (depth == 0) return; // Finished the whole comment
+				continue;
+			}
+
+			// Any other '/' or '*' inside the comment
+			advance();
+		}
+	}
+
 	private void scanString()
 	{
 		let isMultiline = peek() == '"' && peekNext() == '"';
@@ -303,15 +427,15 @@ class Tokenizer
 		if (isMultiline)
 		{
 			// Consume the initial `"""`.
-			scanNextToken('"');
-			scanNextToken('"');
-			scanNextToken('"');
+			advance(2);
 
 			// Scan until the closing `"""` or the end of input.
-			while (!(peek() == '"' && peekNext() == '"' && peekNext(2) == '"') && !isAtEnd())
+			while (true)
 			{
-			    if (peek() == '\n') increaseLine();
-			    advance();
+				m_current = findByte(m_current, '"', '"');
+				if (isAtEnd() || (peekNext() == '"' && peekNext(2) == '"'))
+					break;
+				advance();
 			}
 
 			// If we reached the end without finding `"""`.
@@ -322,17 +446,11 @@ class Tokenizer
 			}
 
 			// Consume the closing `"""`.
-			scanNextToken('"');
-			scanNextToken('"');
-			scanNextToken('"');
+			advance(3);
 		}
 		else
 		{
-			while (peek() != '"' && !isAtEnd())
-			{
-				if (peek() == '\n') increaseLine();
-				advance();
-			}
+			m_current = findByte(m_current, '"', '"');
 
 			if (isAtEnd())
 			{
@@ -345,10 +463,7 @@ class Tokenizer
 			advance();
 		}
 
-		// Trim the surrounding quotes.
-		// let offset = (isMultiline) ? 3 : 1;
-		// let value = substring(m_start + offset, m_current - offset);
-		addToken(.String/*, Variant.Create<StringView>(value)*/);
+		addToken(.String);
 	}
 
 	private void scanChar()
@@ -360,10 +475,10 @@ class Tokenizer
 			return;
 		}
 
-		var c = peek();
+		let c = peek();
 		advance();
 
-		// Handle escape sequences
+		// Skip over escape sequences, the parser works out what they mean.
 		if (c == '\\')
 		{
 		    if (isAtEnd())
@@ -372,23 +487,7 @@ class Tokenizer
 		        return;
 		    }
 
-		    char8 esc = peek();
 		    advance();
-
-		    switch (esc)
-		    {
-		        case 'n': c = '\n'; break;
-		        case 't': c = '\t'; break;
-		        case 'r': c = '\r'; break;
-		        case '0': c = '\0'; break;
-		        case '\'': c = '\''; break;
-		        case '\"': c = '\"'; break;
-		        case '\\': c = '\\'; break;
-		        default:
-		            // Unknown escape sequence
-		            // Lexer error here
-		            break;
-		    }
 		}
 
 		if (peek() != '\'')
@@ -407,22 +506,7 @@ class Tokenizer
 
 	private void scanNumber()
 	{
-		mixin peekWhileIsDigit()
-		{
-			while (isDigit(peek())) advance();
-		}
-
-		/*
-		bool isNegative = false;
-
-		if (m_tokens.Back.Kind == .Minus)
-		{
-			m_tokens.PopBack();
-			// m_tokens.Remove(m_tokens.Back);
-		}
-		*/
-
-		peekWhileIsDigit!();
+		skipClass(CLASS_DIGIT);
 
 		var type = TokenKind.Number_Int;
 
@@ -432,46 +516,50 @@ class Tokenizer
 			// Consume the "."
 			advance();
 
-			peekWhileIsDigit!();
+			skipClass(CLASS_DIGIT);
 
 			type = .Number_Float;
 		}
 
-		// let substring = substring(m_start, m_current);
-
-		switch (type)
-		{
-		case .Number_Int:
-			// let literal = int.Parse(substring);
-			addToken(.Number_Int/*, Variant.Create<int>(literal)*/);
-			break;
-		case .Number_Float:
-			// let literal = float.Parse(substring);
-			addToken(.Number_Float/*, Variant.Create<double>(literal)*/);
-			break;
-		default:
-		}
+		addToken(type);
 	}
 
 	private void scanIdentifier(bool isDirective)
 	{
-		while (isAlphaNumeric(peek()))
-		{
-			advance();
-		}
+		skipClass(CLASS_ALPHANUMERIC);
+
 		// Check if the identifer is a reserved keyword.
 		let text = substring(m_start, m_current);
 
-		if (s_keywordsMap.TryGetValue(text, let type))
+		let keyword = lookupKeyword(text);
+		if (keyword != .Identifier)
 		{
-			addToken(type);
+			addToken(keyword);
 		}
 		else
 		{
 			if (isDirective)
 				addToken(.Directive);
 			else
-				addToken(.Identifier);
+				addIdentifierToken(text);
 		}
 	}
-}
\ No newline at end of file
+
+	/// Also used at compile time to build the table, see Process().
+	private static int keywordHash(StringView text, uint32 multiplier, int size)
+	{
+		uint32 hash = (uint32)text.Length;
+		hash = hash * multiplier + (uint8)text[0];
+		hash = hash * multiplier + (uint8)text[text.Length - 1];
+		if (text.Length > 1)
+			hash = hash * multiplier + (uint8)text[1];
+		return (int)(hash & (uint32)(size - 1));
+	}
+
+	/// .Identifier if it's not a keyword.
+	private static TokenKind lookupKeyword(StringView text)
+	{
+		let slot = keywordHash(text, KEYWORD_HASH_MULTIPLIER, KEYWORD_TABLE_SIZE);
+		return (s_keywordLexemes[slot] == text) ? s_keywordKinds[slot] : .Identifier;
+	}
+}
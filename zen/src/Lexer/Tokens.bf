@@ -68,6 +68,7 @@ public enum TokenKind
 
 	// Created from the pre-processor.
 	case C_Code;
+	case Run;				// #run
 
 	case EOF;
 
@@ -122,6 +123,9 @@ public enum TokenKind
 	[RegisterKeyword("extern")]
 	case Extern;
 
+	[RegisterKeyword("soa")]
+	case SoA;
+
 	[RegisterKeyword("namespace")]
 	case Namespace;
 
@@ -140,34 +144,46 @@ struct Token
 	public readonly StringView Lexeme;
 
 	public readonly SourceRange SourceRange;
-	public readonly SourceFileID File;
+
+	/// Interned lexeme of identifiers, StringInterner.INVALID for everything else.
+	public readonly SymbolID Symbol;
 
 	public this(TokenKind kind)
 	{
 		this.Kind = kind;
 		this.Lexeme = String.Empty;
 		this.SourceRange = default;
-		this.File = default;
+		this.Symbol = StringInterner.INVALID;
+	}
+
+	public this(TokenKind kind, StringView lexeme, SourceLocation start)
+		: this(kind, lexeme, start, internIdentifier(kind, lexeme))
+	{
 	}
 
-	public this(TokenKind kind, StringView lexeme, int line, int col, int offset, SourceFileID file)
+	public this(TokenKind kind, StringView lexeme, SourceLocation start, SymbolID symbol)
 	{
 		this.Kind = kind;
 		this.Lexeme = lexeme;
+		this.Symbol = symbol;
 
-		// In case you're worried, \n prevents tokens from being "multi-lined", so this is ok.
-		let start = SourceLocation(file, line, col, offset);
-		let end = SourceLocation(file, line, col + lexeme.Length, offset + lexeme.Length);
-		this.SourceRange = .(start, end);
-
-		this.File = file;
+		// The lexeme is always a slice of the source, so the range is just its length.
+		this.SourceRange = .(start, .(start.Offset + (uint32)lexeme.Length));
 	}
 
-	public this(TokenKind kind, StringView lexeme, SourceRange range, SourceFileID file)
+	public this(TokenKind kind, StringView lexeme, SourceRange range)
 	{
 		this.Kind = kind;
 		this.Lexeme = lexeme;
 		this.SourceRange = range;
-		this.File = file;
+		this.Symbol = internIdentifier(kind, lexeme);
 	}
-}
\ No newline at end of file
+
+	private static SymbolID internIdentifier(TokenKind kind, StringView lexeme)
+	{
+		if (kind == .Identifier)
+			return StringInterner.Global.Intern(lexeme);
+
+		return StringInterner.INVALID;
+	}
+}
@@ -11,6 +11,26 @@ enum DeclarationKind
 	Count
 }
 
+/// How a fixed-size array of structs is laid out, picked with the 'soa' modifier.
+enum DataLayout
+{
+	/// One whole struct after the other, like C.
+	ArrayOfStructs,
+	/// A separate array for every field, so a loop only streams the fields it actually touches.
+	StructOfArrays
+}
+
+/// What it takes to keep an array access in bounds, worked out by the Checker.
+enum BoundsCheck
+{
+	/// Proven to be in bounds, or there's no count to check against (pointers and strings).
+	None,
+	/// Checked right where the element gets accessed.
+	Inline,
+	/// Covered by a single check before the loop it's in, see AstNode.Stmt.For.HoistedBoundsCount.
+	Hoisted
+}
+
 enum StmtKind
 {
 	case Return(AstNode.Stmt.Return);
@@ -48,10 +68,21 @@ enum ExpressionKind
 	case Index(AstNode.Expression.Index);
 	case CompositeLiteral(AstNode.Expression.CompositeLiteral);
 	case InlinedC(AstNode.Expression.InlinedC);
+	case Run(AstNode.Expression.Run);
 }
 
+/// Nodes live in the arena of the file they were parsed from (CompFile.Arena) and don't own each other.
 abstract class AstNode
 {
+	/// Nodes created on the current thread so far, the profiler counts a file's nodes by diffing this around its parse.
+	[ThreadStatic]
+	public static int CreatedCount;
+
+	public this()
+	{
+		CreatedCount++;
+	}
+
 	/// Statement nodes.
 	public abstract class Stmt : AstNode
 	{
@@ -65,7 +96,7 @@ abstract class AstNode
 		public class Return : Stmt
 		{
 			public readonly Token Token;
-			public readonly Expression Value ~ delete _;
+			public readonly Expression Value;
 
 			public this(Token token, Expression value)
 			{
@@ -78,7 +109,7 @@ abstract class AstNode
 
 		public class Block : Stmt, IScope
 		{
-			public readonly List<AstNode.Stmt> List ~ DeleteContainerAndItems!(_);
+			public readonly List<AstNode.Stmt> List;
 			public readonly Token Open, Close;
 
 			public Scope Scope { get => m_scope; set => m_scope = value; }
@@ -109,9 +140,9 @@ abstract class AstNode
 
 			public readonly FunctionKind Kind;
 			public readonly Token Name;
-			public readonly Expression.NamedType Type ~ delete _;
-			public readonly Block Body ~ delete _;
-			public List<AstNode.Stmt.VariableDeclaration> Parameters ~ DeleteContainerAndItems!(_);
+			public readonly Expression.NamedType Type;
+			public readonly Block Body;
+			public List<AstNode.Stmt.VariableDeclaration> Parameters;
 
 			public Scope Scope { get => m_scope; set => m_scope = value; }
 			private Scope m_scope;
@@ -138,16 +169,19 @@ abstract class AstNode
 
 			public readonly StructKind Kind;
 			public readonly Token Name;
-			public readonly List<VariableDeclaration> Fields ~ DeleteContainerAndItems!(_);
+			public readonly List<VariableDeclaration> Fields;
+			/// Applies to every array of this struct, see ArrayType.SoA.
+			public readonly DataLayout Layout;
 
 			public Scope Scope { get => m_scope; set => m_scope = value; }
 			private Scope m_scope;
 
-			public this(StructKind kind, Token name, List<VariableDeclaration> fields)
+			public this(StructKind kind, Token name, List<VariableDeclaration> fields, DataLayout layout = .ArrayOfStructs)
 			{
 				this.Kind = kind;
 				this.Name = name;
 				this.Fields = fields;
+				this.Layout = layout;
 			}
 
 			public override StmtKind GetKind() => .StructDecl(this);
@@ -163,7 +197,7 @@ abstract class AstNode
 
 			public readonly EnumKind Kind;
 			public readonly Token Name;
-			public readonly List<EnumFieldValue> Values ~ DeleteContainerAndItems!(_);
+			public readonly List<EnumFieldValue> Values;
 
 			public Scope Scope { get => m_scope; set => m_scope = value; }
 			private Scope m_scope;
@@ -173,6 +207,9 @@ abstract class AstNode
 				this.Kind = kind;
 				this.Name = name;
 				this.Values = values;
+
+				for (let value in values)
+					value.Enum = this;
 			}
 
 			public override StmtKind GetKind() => .EnumDecl(this);
@@ -181,7 +218,10 @@ abstract class AstNode
 		public class EnumFieldValue : Stmt
 		{
 			public readonly Token Name;
-			public readonly Expression Value ~ delete _;
+			public readonly Expression Value;
+
+			/// The enum this value belongs to, set by the enum's declaration.
+			public EnumDeclaration Enum;
 
 			public this(Token name, Expression value)
 			{
@@ -196,17 +236,20 @@ abstract class AstNode
 		{
 			public readonly DeclarationKind Kind;
 			public readonly Token Name;
-			public readonly Expression.NamedType Type ~ delete _;
+			public readonly Expression.NamedType Type;
 			public readonly Token? Operator;
-			public readonly Expression Initializer ~ if (_ != null) delete _;
+			public readonly Expression Initializer;
+			/// Only for arrays of structs, lays out just this array as a struct of arrays.
+			public readonly DataLayout Layout;
 
-			public this(DeclarationKind kind, Token name, Expression.NamedType type, Token? op, Expression init)
+			public this(DeclarationKind kind, Token name, Expression.NamedType type, Token? op, Expression init, DataLayout layout = .ArrayOfStructs)
 			{
 				this.Kind = kind;
 				this.Name = name;
 				this.Type = type;
 				this.Operator = op;
 				this.Initializer = init;
+				this.Layout = layout;
 			}
 
 			public override StmtKind GetKind() => .VarDecl(this);
@@ -215,8 +258,8 @@ abstract class AstNode
 		public class ConstantDeclaration : Stmt
 		{
 			public readonly Token Name;
-			public readonly Expression.NamedType Type ~ delete _;
-			public readonly Expression Initializer ~ delete _;
+			public readonly Expression.NamedType Type;
+			public readonly Expression Initializer;
 			public readonly Token? Operator;
 
 			public this(Token name, Expression.NamedType type, Expression init, Token? op)
@@ -234,7 +277,7 @@ abstract class AstNode
 		{
 			public readonly Token Name;
 			public readonly Token Token;
-			public readonly List<AstNode.Stmt> Ast ~ DeleteContainerAndItems!(_);
+			public readonly List<AstNode.Stmt> Ast;
 
 			public Scope Scope { get => m_scope; set => m_scope = value; }
 			private Scope m_scope;
@@ -251,9 +294,9 @@ abstract class AstNode
 
 		public class If : Stmt
 		{
-			public readonly Expression Condition ~ delete _;
-			public readonly Block ThenBranch ~ delete _;
-			public readonly Result<Block> ElseBranch = .Err ~ if (ElseBranch case .Ok) delete _.Value;
+			public readonly Expression Condition;
+			public readonly Block ThenBranch;
+			public readonly Result<Block> ElseBranch = .Err;
 
 			public this(Expression condition, Block thenBranch, Block elseBranch)
 			{
@@ -268,10 +311,19 @@ abstract class AstNode
 
 		public class For : Stmt, IScope
 		{
-			public readonly AstNode.Stmt Initialization ~ delete _;
-			public readonly AstNode.Expression Condition ~ delete _;
-			public readonly AstNode.Expression Updation ~ delete _;
-			public readonly AstNode.Stmt Body ~ delete _;
+			public readonly AstNode.Stmt Initialization;
+			public readonly AstNode.Expression Condition;
+			public readonly AstNode.Expression Updation;
+			public readonly AstNode.Stmt Body;
+
+			/// The smallest array the body indexes with the loop's counter on every iteration, or NO_HOISTED_BOUNDS.
+			/// Set by the Checker, the loop's end gets checked against it once before the loop instead of on every access.
+			public int HoistedBoundsCount = NO_HOISTED_BOUNDS;
+			public const int NO_HOISTED_BOUNDS = -1;
+			/// Where the counter starts, the check only fails when the loop runs at all.
+			public int64 HoistedBoundsStart;
+			/// How far the counter goes every iteration, the check is on the last index it actually gets to.
+			public int64 HoistedBoundsStep = 1;
 
 			public Scope Scope { get => m_scope; set => m_scope = value; }
 			private Scope m_scope;
@@ -289,8 +341,8 @@ abstract class AstNode
 
 		public class While : Stmt, IScope
 		{
-			public readonly AstNode.Expression Condition ~ delete _;
-			public readonly AstNode.Stmt Body ~ delete _;
+			public readonly AstNode.Expression Condition;
+			public readonly AstNode.Stmt Body;
 
 			public Scope Scope { get => m_scope; set => m_scope = value; }
 			private Scope m_scope;
@@ -306,7 +358,7 @@ abstract class AstNode
 
 		public class ExpressionStmt : Stmt
 		{
-			public readonly Expression InnerExpr ~ delete _;
+			public readonly Expression InnerExpr;
 
 			public this(Expression expr)
 			{
@@ -324,6 +376,9 @@ abstract class AstNode
 
 		public readonly SourceRange Range;
 
+		/// Set by the Checker when the value is known at compile time, the Generator emits it as a literal instead.
+		public ConstantValue? Folded;
+
 		public this(SourceRange range)
 		{
 			this.Range = range;
@@ -331,9 +386,9 @@ abstract class AstNode
 
 		public class Binary : Expression
 		{
-			public readonly Expression Left ~ delete _;
+			public readonly Expression Left;
 			public readonly Token Op;
-			public readonly Expression Right ~ delete _;
+			public readonly Expression Right;
 			public readonly bool WasCompounded = false;
 
 			public this(Expression left, Token op, Expression right, bool wasCompounded, SourceRange range) : base(range)
@@ -351,6 +406,10 @@ abstract class AstNode
 		{
 			public readonly Token Name;
 
+			/// What the Checker resolved the name to, so later passes don't have to walk the scopes again.
+			/// Only valid after the Checker ran in the current build.
+			public Entity ResolvedEntity;
+
 			public this(Token name, SourceRange range) : base(range)
 			{
 				this.Name = name;
@@ -361,14 +420,17 @@ abstract class AstNode
 
 		public class Call : Expression
 		{
-			public readonly Expression.Variable Callee ~ delete _;
-			public readonly List<Expression> Arguments ~ DeleteContainerAndItems!(_);
+			public readonly Expression.Variable Callee;
+			public readonly List<Expression> Arguments;
 
 			/// Open '(' token
 			public readonly Token Open;
 			/// Close ')' token
 			public readonly Token Close;
 
+			/// For builtins, what the Checker worked out the first argument to be (print picks its format from it).
+			public ZenType? ResolvedArgumentType;
+
 			public this(Expression.Variable callee, List<Expression> arguments, Token open, Token close, SourceRange range) : base(range)
 			{
 				this.Callee = callee;
@@ -382,9 +444,9 @@ abstract class AstNode
 
 		public class Logical : Expression
 		{
-			public readonly Expression Left ~ delete _;
+			public readonly Expression Left;
 			public readonly Token Op;
-			public readonly Expression Right ~ delete _;
+			public readonly Expression Right;
 			
 			public this(Expression left, Token op, Expression right, SourceRange range) : base(range)
 			{
@@ -457,7 +519,7 @@ abstract class AstNode
 		public class Unary : Expression
 		{
 			public readonly Token Operator;
-			public readonly Expression Right ~ delete _;
+			public readonly Expression Right;
 
 			public ZenType StoredType;
 
@@ -472,7 +534,7 @@ abstract class AstNode
 
 		public class Get : Expression
 		{
-			public readonly Expression Object ~ delete _;
+			public readonly Expression Object;
 			public readonly Token Name;
 
 			// @TEMP @HACK
@@ -490,7 +552,7 @@ abstract class AstNode
 
 		public class Set : Expression
 		{
-			public readonly Expression Object ~ delete _;
+			public readonly Expression Object;
 			public readonly Token Name;
 			public readonly Expression Value;
 
@@ -518,7 +580,7 @@ abstract class AstNode
 
 		public class Grouping : Expression
 		{
-			public readonly Expression Expression ~ delete _;
+			public readonly Expression Expression;
 
 			public this(Expression expression, SourceRange range) : base(range)
 			{
@@ -530,8 +592,8 @@ abstract class AstNode
 
 		public class Assign : Expression
 		{
-			public readonly Expression Assignee ~ delete _;
-			public readonly Expression Value ~ delete _;
+			public readonly Expression Assignee;
+			public readonly Expression Value;
 			public readonly Token Op;
 
 			public this(Expression assignee, Expression value, Token op, SourceRange range) : base(range)
@@ -548,7 +610,7 @@ abstract class AstNode
 		{
 			public readonly Token Left;
 			public readonly Token Separator;
-			public readonly Expression Right ~ delete _;
+			public readonly Expression Right;
 
 			public this(Token left, Token separator, Expression right, SourceRange range) : base(range)
 			{
@@ -582,30 +644,13 @@ abstract class AstNode
 				this.Kind = kind;
 			}
 
-			public ~this()
-			{
-				if (this.Kind case .Qualified(let q))
-				{
-					delete q;
-				}
-				if (this.Kind case .Pointer(let innerP))
-				{
-					delete innerP;
-				}
-				if (this.Kind case .Array(let innerArr, let countExpr))
-				{
-					delete innerArr;
-					delete countExpr;
-				}
-			}
-
 			public override ExpressionKind GetKind() => .NamedType(this);
 		}
 
 		public class Cast : Expression
 		{
-			public readonly Expression Value ~ delete _;
-			public readonly NamedType TargetType ~ delete _;
+			public readonly Expression Value;
+			public readonly NamedType TargetType;
 			public readonly Token CastKeyword;
 
 			public this(Expression value, NamedType targetType, Token keyword, SourceRange range) : base(range)
@@ -620,11 +665,20 @@ abstract class AstNode
 
 		public class Index : Expression
 		{
-			public readonly Expression Array ~ delete _;
-			public readonly Expression Index ~ delete _;
+			public readonly Expression Array;
+			public readonly Expression Index;
 			public readonly Token LeftBracket;
 			public readonly Token RightBracket;
 
+			/// Indexes a struct of arrays, set by the Checker. The only thing that can be done with the element is getting one of its fields,
+			/// which the Generator turns around ('a[i].x' is 'a.x[i]' in C).
+			public bool IsSoA;
+
+			/// Set by the Checker, only acted on when the build asks for bounds checks (see BuildContext.BoundsChecks).
+			public BoundsCheck Bounds;
+			/// The count of the array being indexed, what an inline check compares against.
+			public int BoundsCount;
+
 			public this(Expression array, Expression index, Token left, Token right, SourceRange range) : base(range)
 			{
 				this.Array = array;
@@ -638,7 +692,7 @@ abstract class AstNode
 
 		public class CompositeLiteral : Expression
 		{
-			public readonly List<Expression> Elements ~ DeleteContainerAndItems!(_);
+			public readonly List<Expression> Elements;
 			public readonly Token LBrace;
 			public readonly Token RBrace;
 
@@ -667,6 +721,29 @@ abstract class AstNode
 
 			public override ExpressionKind GetKind() => .InlinedC(this);
 		}
+
+		/// '#run f()', a call that gets made while compiling, see CompileTimeRunner.
+		/// As an initializer its result ends up in Folded, as a statement of its own (outside of functions) it's only run for what it does to the globals.
+		public class Run : Expression
+		{
+			public readonly Token Token;
+			public readonly Expression Value;
+
+			/// Set by the Checker.
+			public Scope Scope;
+			public ZenType ResolvedType;
+			public bool IsStatement;
+			/// The constant this initializes, which gets the result as its value.
+			public Entity.Constant Constant;
+
+			public this(Token token, Expression value, SourceRange range) : base(range)
+			{
+				this.Token = token;
+				this.Value = value;
+			}
+
+			public override ExpressionKind GetKind() => .Run(this);
+		}
 	}
 }
 
@@ -28,6 +28,7 @@ public enum DirectiveKind
 {
 	Load,
 	C,
+	Run,
 	If,
 	Else,
 	EndIf,
@@ -72,7 +73,7 @@ class DirectivePreprocessor : Visitor
 					let offset = (isMultiline) ? 3 : 1;
 					let trimmedPath = pathToken.Lexeme.Substring(offset, pathToken.Lexeme.Length - 1 - offset);
 					
-					result.FilesToLoad.Add(new .(pathToken.File, trimmedPath, pathToken));
+					result.FilesToLoad.Add(new .(srcFile.ID, trimmedPath, pathToken));
 					break;
 				case "#c":
 					let lbrace = consume(.LeftBrace, "Expected '{'");
@@ -97,15 +98,20 @@ class DirectivePreprocessor : Visitor
 					let rbrace = consume(.RightBrace, "Expected '}'");
 
 					let codeSrcRange = SourceRange(lbrace.SourceRange.End, rbrace.SourceRange.Start);
-					let code = srcFile.Content.Substring(codeSrcRange.Start.Offset, codeSrcRange.End.Offset - codeSrcRange.Start.Offset - 1);
+					let codeStart = srcFile.GetLocalOffset(codeSrcRange.Start) + 1;
+					let code = srcFile.Content.Substring(codeStart, srcFile.GetLocalOffset(codeSrcRange.End) - codeStart);
 
-					outTokens.Add(Token(.C_Code, code, codeSrcRange, srcFile.ID));
+					outTokens.Add(Token(.C_Code, code, codeSrcRange));
 
 					// This semicolon IS actually required for the parser to validate the expression it creates.
 					// Yeah, we could've added it automatically, but then we would've needed to check if there was a semicolon, and that's a whole can of worms.
 					// It's just more consistent like this tbh.
 					outTokens.Add(consume(.Semicolon, "Expected ';'"));
 					break;
+				case "#run":
+					// Works on the expression after it, so the parser takes it from here (see AstNode.Expression.Run).
+					outTokens.Add(Token(.Run, name.Lexeme, name.SourceRange));
+					break;
 				default:
 					reportError(name, "Unknown directive type");
 					break;
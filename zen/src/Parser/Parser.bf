@@ -8,18 +8,22 @@ class Parser : Visitor
 	private readonly Ast m_ast;
 	private readonly List<Token> m_tokens;
 
+	/// Every node gets allocated in here, the nodes don't own each other.
+	private readonly BumpAllocator m_alloc;
+
 	private int m_current = 0;
 	private bool m_insideFunction = false;
 
-	public this(List<Token> tokens, Ast ast)
+	public this(List<Token> tokens, Ast ast, BumpAllocator alloc)
 	{
 		this.m_tokens = tokens;
 		this.m_ast = ast;
+		this.m_alloc = alloc;
 	}
 
 	public Result<Ast> Run()
 	{
-		m_ast.ClearAndDeleteItems();
+		m_ast.Clear();
 
 		while (!isAtEnd() && !HadErrors)
 		{
@@ -30,7 +34,7 @@ class Parser : Visitor
 			}
 		}
 
-		m_ast.Add(new AstNode.Stmt.EOF());
+		m_ast.Add(new:m_alloc AstNode.Stmt.EOF());
 		return HadErrors ? .Err : .Ok(m_ast);
 	}
 
@@ -47,6 +51,17 @@ class Parser : Visitor
 			else
 				reportError(previous(), "Only functions can be declared as 'extern'");
 		}
+		if (match(.SoA))
+		{
+			if (match(.Struct))
+				return getStructStmt(false, .StructOfArrays);
+			else if (match(.Let))
+				return getVariableStmt(previous(), .Immutable, .StructOfArrays);
+			else if (match(.Var))
+				return getVariableStmt(previous(), .Mutable, .StructOfArrays);
+			else
+				reportError(previous(), "Only structs and array variables can be declared as 'soa'");
+		}
 		if (match(.Function))
 		{
 			return getFunctionStmt(false);
@@ -27,11 +27,11 @@ extension Parser
 		{
 			let name = consume(.Identifier, "Expected identifier.");
 			let range =  SourceRange(token.SourceRange.Start, name.SourceRange.End);
-			let qualified = new AstNode.Expression.QualifiedName(token, past(2), new AstNode.Expression.Variable(name, name.SourceRange), range);
-			return new .(.Qualified(qualified), range);
+			let qualified = new:m_alloc AstNode.Expression.QualifiedName(token, past(2), new:m_alloc AstNode.Expression.Variable(name, name.SourceRange), range);
+			return new:m_alloc AstNode.Expression.NamedType(.Qualified(qualified), range);
 		}
 
-		return new .(.Simple(token), token.SourceRange);
+		return new:m_alloc AstNode.Expression.NamedType(.Simple(token), token.SourceRange);
 	}
 
 	private AstNode.Expression.NamedType consumeType()
@@ -54,13 +54,13 @@ extension Parser
 				let rbrack = consume(.RightBracket, "Expected ']'");
 
 				let range = SourceRange(baseType.Range.Start, rbrack.SourceRange.End); // Starts at the identifier, ends at the closing bracket
-				baseType = new .(.Array(baseType, count), range);
+				baseType = new:m_alloc AstNode.Expression.NamedType(.Array(baseType, count), range);
 			}
 			if (match(.Star))
 			{
 				let star = previous();
 				let range = SourceRange(baseType.Range.Start, star.SourceRange.End); // Starts at the identifier, ends at the star(s)
-				baseType = new .(.Pointer(baseType), range);
+				baseType = new:m_alloc AstNode.Expression.NamedType(.Pointer(baseType), range);
 			}
 		}
 
@@ -79,7 +79,7 @@ extension Parser
 
 		consume(.Semicolon, "Semicolon expected.");
 
-		return new .(token, value);
+		return new:m_alloc AstNode.Stmt.Return(token, value);
 	}
 
 	private AstNode.Stmt.FunctionDeclaration getFunctionStmt(bool isExtern)
@@ -94,7 +94,7 @@ extension Parser
 		let name = consume(.Identifier, "Expected name.");
 
 		// Parameters
-		let parameters = new List<AstNode.Stmt.VariableDeclaration>();
+		let parameters = new:m_alloc List<AstNode.Stmt.VariableDeclaration>();
 		consume(.LeftParen, "Expected '('.");
 		if (!check(.RightParen))
 		{
@@ -115,7 +115,7 @@ extension Parser
 				let pType = consumeType();
 				let pName = consume(.Identifier, "Expected parameter name.");
 
-				parameters.Add(new .(accessor, pName, pType, null, null));
+				parameters.Add(new:m_alloc AstNode.Stmt.VariableDeclaration(accessor, pName, pType, null, null));
 			}
 			while (match(.Comma));
 		}
@@ -127,25 +127,25 @@ extension Parser
 			m_insideFunction = true;
 
 			// Body
-			let bodyList = scanBlock(.. new .(), var open, var close);
-			body = new AstNode.Stmt.Block(bodyList, open, close);
+			let bodyList = scanBlock(.. new:m_alloc List<AstNode.Stmt>(), var open, var close);
+			body = new:m_alloc AstNode.Stmt.Block(bodyList, open, close);
 		}
 		else
 		{
 			consume(.Semicolon, "Semicolon expected.");
 		}
 
-		return new .(isExtern ? .Extern : .Normal, name, type, body, parameters);
+		return new:m_alloc AstNode.Stmt.FunctionDeclaration(isExtern ? .Extern : .Normal, name, type, body, parameters);
 	}
 
-	private AstNode.Stmt.StructDeclaration getStructStmt(bool isExtern)
+	private AstNode.Stmt.StructDeclaration getStructStmt(bool isExtern, DataLayout layout = .ArrayOfStructs)
 	{
 		let name = consume(.Identifier, "Expected name.");
 
 		// Body
 		consume(.LeftBrace, "Expected '{'.");
 
-		let fields = new List<AstNode.Stmt.VariableDeclaration>();
+		let fields = new:m_alloc List<AstNode.Stmt.VariableDeclaration>();
 		while (!check(.RightBrace) && !isAtEnd())
 		{
 			let pType = consumeType();
@@ -162,14 +162,14 @@ extension Parser
 
 			consume(.Semicolon, "Semicolon expected.");
 
-			fields.Add(new .(.Immutable, pName, pType, op, initializer));
+			fields.Add(new:m_alloc AstNode.Stmt.VariableDeclaration(.Immutable, pName, pType, op, initializer));
 			// list.Add(scanNextStmt());
 			// fields.Add((AstNode.Stmt.VariableDeclaration)scanNextStmt());
 		}
 
 		consume(.RightBrace, "Expected '}'.");
 
-		return new .(isExtern ? .Extern : .Normal, name, fields);
+		return new:m_alloc AstNode.Stmt.StructDeclaration(isExtern ? .Extern : .Normal, name, fields, layout);
 	}
 
 	private AstNode.Stmt.EnumDeclaration getEnumStmt(bool isExtern)
@@ -179,7 +179,7 @@ extension Parser
 		// Body
 		consume(.LeftBrace, "Expected '{'.");
 
-		let values = new List<AstNode.Stmt.EnumFieldValue>();
+		let values = new:m_alloc List<AstNode.Stmt.EnumFieldValue>();
 		int scopeDepth = 0;
 		int valueIndex = 0;
 		while (true && !isAtEnd())
@@ -223,17 +223,17 @@ extension Parser
 			else
 			{
 				let range = valueName.SourceRange;
-				value = new AstNode.Expression.Literal(valueName, Variant.Create<int>(valueIndex), valueIndex.ToString(.. scope .()), range);
+				value = new:m_alloc AstNode.Expression.Literal(valueName, Variant.Create<int>(valueIndex), valueIndex.ToString(.. scope .()), range);
 			}
 
-			values.Add(new .(valueName, value));
+			values.Add(new:m_alloc AstNode.Stmt.EnumFieldValue(valueName, value));
 
 			valueIndex++;
 		}
 
 		consume(.RightBrace, "Expected '}'.");
 
-		return new .(isExtern ? .Extern : .Normal, name, values);
+		return new:m_alloc AstNode.Stmt.EnumDeclaration(isExtern ? .Extern : .Normal, name, values);
 	}
 
 	private AstNode.Stmt.NamespaceDeclaration getNamespaceStmt()
@@ -243,13 +243,13 @@ extension Parser
 
 		consume(.Semicolon, "Semicolon expected.");
 
-		List<AstNode.Stmt> list = new .();
+		List<AstNode.Stmt> list = new:m_alloc List<AstNode.Stmt>();
 		while (!check(.EOF) && !isAtEnd())
 		{
 			list.Add(scanNextStmt());
 		}
 
-		return new .(name, token, list);
+		return new:m_alloc AstNode.Stmt.NamespaceDeclaration(name, token, list);
 	}
 
 	private AstNode.Stmt.If getIfStmt()
@@ -263,19 +263,19 @@ extension Parser
 
 		// "Then" branch
 		{
-			let thenBlock = scanBlock(.. new .(), var open, var close);
-			thenBranch = new AstNode.Stmt.Block(thenBlock, open, close);
+			let thenBlock = scanBlock(.. new:m_alloc List<AstNode.Stmt>(), var open, var close);
+			thenBranch = new:m_alloc AstNode.Stmt.Block(thenBlock, open, close);
 		}
 
 		// "Else" branch
 		if (match(.Else))
 		{
-			let elseBlock = scanBlock(.. new .(), var open, var close);
-			elseBranch = new AstNode.Stmt.Block(elseBlock, open, close);
+			let elseBlock = scanBlock(.. new:m_alloc List<AstNode.Stmt>(), var open, var close);
+			elseBranch = new:m_alloc AstNode.Stmt.Block(elseBlock, open, close);
 		}
 
 		Debug.Assert(thenBranch != null);
-		return new .(condition, thenBranch, elseBranch);
+		return new:m_alloc AstNode.Stmt.If(condition, thenBranch, elseBranch);
 	}
 
 	private AstNode.Stmt.For getForStmt()
@@ -313,7 +313,7 @@ extension Parser
 
 		let body = node();
 
-		return new .(initializer, condition, update, body);
+		return new:m_alloc AstNode.Stmt.For(initializer, condition, update, body);
 	}
 
 	private AstNode.Stmt.While getWhileStmt()
@@ -332,22 +332,22 @@ extension Parser
 
 		let body = node();
 
-		return new .(condition, body);
+		return new:m_alloc AstNode.Stmt.While(condition, body);
 	}
 
 	private AstNode.Stmt node()
 	{
 		if (check(.LeftBrace))
 		{
-			let list = new List<AstNode.Stmt>();
+			let list = new:m_alloc List<AstNode.Stmt>();
 			let blockNodes = scanBlock(list, var open, var close);
-			return new AstNode.Stmt.Block(blockNodes, open, close);
+			return new:m_alloc AstNode.Stmt.Block(blockNodes, open, close);
 		}
 
 		return getExpressionStmt();
 	}
 
-	private AstNode.Stmt.VariableDeclaration getVariableStmt(Token accessor, DeclarationKind kind)
+	private AstNode.Stmt.VariableDeclaration getVariableStmt(Token accessor, DeclarationKind kind, DataLayout layout = .ArrayOfStructs)
 	{
 		let type = consumeType();
 		let name = consume(.Identifier, "Expected variable name.");
@@ -363,7 +363,7 @@ extension Parser
 
 		consume(.Semicolon, "Semicolon expected.");
 
-		return new .(kind, name, type, op, initializer);
+		return new:m_alloc AstNode.Stmt.VariableDeclaration(kind, name, type, op, initializer, layout);
 	}
 
 	private AstNode.Stmt.ConstantDeclaration getConstStmt()
@@ -390,6 +390,6 @@ extension Parser
 
 		consume(.Semicolon, "Semicolon expected.");
 
-		return new .(name, type, initializer, op);
+		return new:m_alloc AstNode.Stmt.ConstantDeclaration(name, type, initializer, op);
 	}
 }
\ No newline at end of file
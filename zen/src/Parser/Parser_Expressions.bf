@@ -11,7 +11,7 @@ extension Parser
 		let expr = getExpression();
 		consume(.Semicolon, "Expected ';' after value.");
 
-		return new .(expr);
+		return new:m_alloc AstNode.Stmt.ExpressionStmt(expr);
 	}
 
 	private AstNode.Expression getExpression()
@@ -30,7 +30,7 @@ extension Parser
 			}
 
 			let token = previous();
-			return new AstNode.Expression.InlinedC(token, token.Lexeme, token.SourceRange);
+			return new:m_alloc AstNode.Expression.InlinedC(token, token.Lexeme, token.SourceRange);
 		}
 
 		return getExprAssignment();
@@ -50,7 +50,7 @@ extension Parser
 			if (equals.Type != .Equal)
 			{
 				let compoundOp = getCompoundOperator(equals.Type, equals);
-				let binary = new Expression.Binary(expr, compoundOp, value, true);
+				let binary = new:m_alloc Expression.Binary(expr, compoundOp, value, true);
 				value = binary;
 			}
 			*/
@@ -58,11 +58,11 @@ extension Parser
 			/*
 			if (let varExpr = expr as Expression.Variable)
 			{
-				expr = new Expression.Assign(varExpr, value, equals);
+				expr = new:m_alloc Expression.Assign(varExpr, value, equals);
 			}
 			else if (let getExpr = expr as Expression.Get)
 			{
-				expr = new Expression.Assign(getExpr, value, equals);
+				expr = new:m_alloc Expression.Assign(getExpr, value, equals);
 			}
 			*/
 
@@ -70,12 +70,11 @@ extension Parser
 			if (expr is Expression.Variable || expr is Expression.Get || expr is Expression.Index)
 			{
 				let range = SourceRange(expr.Range.Start, value.Range.End);
-				expr = new Expression.Assign(expr, value, equals, range);
+				expr = new:m_alloc Expression.Assign(expr, value, equals, range);
 			}
 			else
 			{
 				reportError(equals, "Invalid assignment target.");
-				delete expr;
 			}
 		}
 
@@ -91,7 +90,7 @@ extension Parser
 			let op = previous();
 			let right = getExprAnd();
 			let range = SourceRange(expr.Range.Start, right.Range.End);
-			expr = new Expression.Logical(expr, op, right, range);
+			expr = new:m_alloc Expression.Logical(expr, op, right, range);
 		}
 
 		return expr;
@@ -106,7 +105,7 @@ extension Parser
 			let op = previous();
 			let right = getExprEquality();
 			let range = SourceRange(expr.Range.Start, right.Range.End);
-			expr = new Expression.Logical(expr, op, right, range);
+			expr = new:m_alloc Expression.Logical(expr, op, right, range);
 		}
 
 		return expr;
@@ -147,13 +146,24 @@ extension Parser
 			let op = previous();
 			let right = getExprUnary();
 			let range = SourceRange(op.SourceRange.Start, right.Range.End);
-			return new Expression.Unary(op, right, range);
+			return new:m_alloc Expression.Unary(op, right, range);
 		}
 
 		bool isCasting = false;
 		Token? castToken = ?;
 		Expression.NamedType castType = ?;
 
+		if (match(.Run))
+		{
+			let token = previous();
+			if (m_insideFunction)
+				reportError(token, "'#run' can only be used outside of functions");
+
+			let value = getExprCall();
+			let range = SourceRange(token.SourceRange.Start, value.Range.End);
+			return new:m_alloc AstNode.Expression.Run(token, value, range);
+		}
+
 		if (match(.Cast))
 		{
 			isCasting = true;
@@ -167,7 +177,7 @@ extension Parser
 
 			// I never realized how out of order some of these ranges are lol
 			let range = SourceRange(castToken.Value.SourceRange.Start, callValue.Range.End);
-			return new AstNode.Expression.Cast(callValue, castType, castToken.Value, range);
+			return new:m_alloc AstNode.Expression.Cast(callValue, castType, castToken.Value, range);
 		}
 
 		return getExprCall();
@@ -198,7 +208,7 @@ extension Parser
 			{
 				// @HACK
 				// This feels kinda hacky...
-				delete expr;
+				// The variable we just parsed is left in the arena.
 				retreat();
 				retreat();
 
@@ -207,13 +217,13 @@ extension Parser
 				let right = getExprCall();
 
 				let range = SourceRange(left.SourceRange.Start, right.Range.End);
-				expr = new Expression.QualifiedName(left, separator, right, range);
+				expr = new:m_alloc Expression.QualifiedName(left, separator, right, range);
 			}
 			else if (match(.Dot))
 			{
 				let name = consume(.Identifier, "Expected property name after '.'.");
 				let range = SourceRange(expr.Range.Start, name.SourceRange.End);
-				expr = new Expression.Get(expr, name, range);
+				expr = new:m_alloc Expression.Get(expr, name, range);
 			}
 			else
 			{
@@ -228,7 +238,7 @@ extension Parser
 	private Expression finishCallExpr(Expression.Variable callee)
 	{
 		let open = previous();
-		let arguments = new List<Expression>();
+		let arguments = new:m_alloc List<Expression>();
 		if (!check(.RightParen))
 		{
 			repeat
@@ -241,7 +251,7 @@ extension Parser
 		let close = consume(.RightParen, "Expected ')' after arguments.");
 
 		let range = SourceRange(callee.Range.Start, close.SourceRange.End);
-		return new Expression.Call(callee, arguments, open, close, range);
+		return new:m_alloc Expression.Call(callee, arguments, open, close, range);
 	}
 
 	private Expression getExprPostfix()
@@ -257,7 +267,7 @@ extension Parser
 				let rbrack = consume(.RightBracket, "Expected ']' after index expression");
 
 				let range = SourceRange(lbrack.SourceRange.Start, rbrack.SourceRange.End);
-				expr = new Expression.Index(expr, index, lbrack, rbrack, range);
+				expr = new:m_alloc Expression.Index(expr, index, lbrack, rbrack, range);
 			}
 			else
 			{
@@ -298,7 +308,7 @@ extension Parser
 			}
 
 			let range = token.SourceRange; // Literals just use the token directly so this is fine
-			returnValue!(new Expression.Literal(token, value, token.Lexeme, range));
+			returnValue!(new:m_alloc Expression.Literal(token, value, token.Lexeme, range));
 		}
 
 		if (match(.This))
@@ -306,14 +316,14 @@ extension Parser
 			// @TODO
 			// I don't remember what this does lol
 			let range = previous().SourceRange;
-			returnValue!(new Expression.This(previous(), range));
+			returnValue!(new:m_alloc Expression.This(previous(), range));
 		}
 
 		if (match(.Identifier))
 		{
 			let token = previous();
 			let range = token.SourceRange;
-			returnValue!(new Expression.Variable(token, range));
+			returnValue!(new:m_alloc Expression.Variable(token, range));
 		}
 
 		if (match(.LeftParen))
@@ -323,7 +333,7 @@ extension Parser
 			let rparen = consume(.RightParen, "Expected ')' after expression.");
 
 			let range = SourceRange(lparen.SourceRange.Start, rparen.SourceRange.End);
-			returnValue!(new Expression.Grouping(expr, range));
+			returnValue!(new:m_alloc Expression.Grouping(expr, range));
 		}
 
 		if (check(.LeftBrace))
@@ -339,7 +349,7 @@ extension Parser
 	private Expression.CompositeLiteral getExprCompositeLiteral()
 	{
 		let lbrace = consume(.LeftBrace, "Expected '{'");
-		let elements = new List<Expression>();
+		let elements = new:m_alloc List<Expression>();
 
 		if (!check(.RightBrace))
 		{
@@ -352,7 +362,7 @@ extension Parser
 		let rbrace = consume(.RightBrace, "Expected '}'");
 
 		let range = SourceRange(lbrace.SourceRange.Start, rbrace.SourceRange.End);
-		return new .(elements, lbrace, rbrace, range);
+		return new:m_alloc AstNode.Expression.CompositeLiteral(elements, lbrace, rbrace, range);
 	}
 
 	private Expression parseLeftAssociativeBinaryOparation(function Expression(Self this) higherPrecedence, params TokenKind[] tokenTypes)
@@ -365,7 +375,7 @@ extension Parser
 			let right = higherPrecedence(this);
 
 			let range = SourceRange(expr.Range.Start, right.Range.End);
-			expr = new Expression.Binary(expr, op, right, false, range);
+			expr = new:m_alloc Expression.Binary(expr, op, right, false, range);
 		}
 
 		return expr;
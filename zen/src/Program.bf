@@ -2,6 +2,7 @@ using System;
 using System.IO;
 using System.Collections;
 using System.Globalization;
+using System.Threading;
 
 namespace Zen;
 
@@ -14,6 +15,13 @@ class Program
 		public bool KeepOpen = false;
 		public bool DontBuild = false;
 		public bool PrintScopes = false;
+		public bool Watch = false;
+		public bool Split = false;
+		public bool Profile = false;
+		public bool KeepDead = false;
+		public bool PrintStripped = false;
+		public bool Release = false;
+		public bool Benchmark = false;
 	}
 
 	public static int Main(String[] args)
@@ -43,16 +51,83 @@ class Program
 			case "-printscopes":
 				cliArgs.PrintScopes = true;
 				break;
+			case "-watch":
+				cliArgs.Watch = true;
+				break;
+			case "-split":
+				cliArgs.Split = true;
+				break;
+			case "-profile":
+				cliArgs.Profile = true;
+				break;
+			case "-keepdead":
+				cliArgs.KeepDead = true;
+				break;
+			case "-printstripped":
+				cliArgs.PrintStripped = true;
+				break;
+			case "-release":
+				cliArgs.Release = true;
+				break;
+			case "-bench":
+				cliArgs.Benchmark = true;
+				break;
 			}
 		}
 
-		run_compiler(cliArgs);
+		if (cliArgs.Benchmark)
+			run_benchmark(cliArgs);
+		else if (cliArgs.Watch)
+			run_watch(cliArgs);
+		else
+			run_compiler(cliArgs);
 		
 		return 0;
 	}
 
 	private static let outputFiles = new List<CFile>() ~ DeleteContainerAndItems!(_);
 
+	private static void fill_build_context(CLIArguments args, BuildContext context)
+	{
+		context.PrintScopes = args.PrintScopes;
+		context.SplitTranslationUnits = args.Split;
+		context.Profile = args.Profile;
+		context.StripDeadCode = !args.KeepDead;
+		context.PrintStripped = args.PrintStripped;
+		context.BoundsChecks = !args.Release;
+	}
+
+	/// Written next to the generated sources, see Profiler.WriteChromeTrace().
+	private static void write_profile(Profiler profiler, String outputDirectory)
+	{
+		let path = Path.Combine(.. scope .(), outputDirectory, "profile.json");
+		if (profiler.WriteChromeTrace(path) case .Ok)
+		{
+			Console.ForegroundColor = .DarkGray;
+			Console.WriteLine(scope $"Profile written to {path}");
+			Console.ResetColor();
+		}
+	}
+
+	/// With '-bench' the input is the directory the generated programs and the results go into, see Benchmark.
+	private static void run_benchmark(CLIArguments args)
+	{
+		let context = fill_build_context(args, .. scope .());
+
+		let benchmark = scope Benchmark(args.MainFile, context);
+		if (benchmark.Run() case .Err)
+		{
+			Console.ForegroundColor = .Red;
+			Console.WriteLine("Benchmark failed.");
+			Console.ResetColor();
+		}
+
+		if (args.KeepOpen)
+		{
+			Console.ReadLine("");
+		}
+	}
+
 	private static void run_compiler(CLIArguments args)
 	{
 		// @TEMP
@@ -63,15 +138,16 @@ class Program
 		{
 			if (args.RunAfterBuild)
 			{
-				let path = Path.Combine(.. scope .(), outputDirectory, "main.c");
-				execute_c_code(File.ReadAllText(path, .. scope .()), outputDirectory);
+				execute_output_directory(outputDirectory, scope .());
 			}
 
 			return;
 		}
 
+		let context = fill_build_context(args, .. scope .());
+
 		let builder = scope Builder();
-		let buildResult = builder.Run(args.MainFile, outputDirectory, outputFiles, args.PrintScopes);
+		let buildResult = builder.Run(args.MainFile, outputDirectory, outputFiles, context);
 
 		Console.ResetColor();
 
@@ -94,43 +170,105 @@ class Program
 				Console.Write(scope $" {seconds.ToString(.. scope .(), secondsFormat, CultureInfo.InvariantCulture)}s \n");
 			}
 
+			bool writeFailed = false;
+			if (!builder.UpToDate)
+			{
+				writeFailed = builder.WriteOutputFiles(buildResult.Value.Files, outputDirectory) case .Err;
+			}
+
 			Console.ForegroundColor = .DarkGray;
-			// Console.WriteLine(scope $"{builder.FilesWritten} {(builder.FilesWritten == 1) ? "file" : "files" } written");
+			if (builder.UpToDate)
+				Console.WriteLine("Up to date, nothing to build");
+			else
+				Console.WriteLine(scope $"{builder.FilesWritten} {(builder.FilesWritten == 1) ? "file" : "files" } written, {builder.FilesUnchanged} unchanged");
+			Console.WriteLine(scope $"Cache: {builder.CacheHits} {(builder.CacheHits == 1) ? "hit" : "hits" }, {builder.CacheMisses} {(builder.CacheMisses == 1) ? "miss" : "misses" }");
 
-			let lexerTime = builder.StopwatchLexer.Elapsed.TotalSeconds;
-			let parserTime = builder.StopwatchParser.Elapsed.TotalSeconds;
+			let loaderTime = builder.StopwatchLoader.Elapsed.TotalSeconds;
 			let checkerTime = builder.StopwatchChecker.Elapsed.TotalSeconds;
 			let codegenTime = builder.StopwatchCodegen.Elapsed.TotalSeconds;
 
-			/*
-			writeTimeOutput("Lexing    time:", lexerTime);
-			writeTimeOutput("Parsing   time:", parserTime);
-			writeTimeOutput("Compiling time:", compilerTime);
-			writeTimeOutput("Codegen   time:", codegenTime);
-			writeTimeOutput("Total     time:", lexerTime + parserTime + compilerTime + codegenTime);
-			*/
+			if (args.Profile)
+			{
+				// Lexing and parsing run on the worker pool, so these are summed over every worker and won't add up to the frontend time.
+				writeTimeOutput("Lexing    time:", builder.LexerTime.TotalSeconds);
+				writeTimeOutput("Parsing   time:", builder.ParserTime.TotalSeconds);
+				writeTimeOutput("Checking  time:", checkerTime);
+				writeTimeOutput("Codegen   time:", codegenTime);
+			}
 
-			writeTimeOutput("Frontend time:", lexerTime + parserTime + checkerTime);
+			writeTimeOutput("Frontend time:", loaderTime + checkerTime);
 			writeTimeOutput("Backend  time:", codegenTime);
-			writeTimeOutput("Total    time:", lexerTime + parserTime + checkerTime + codegenTime);
-
-			Console.ResetColor();
+			writeTimeOutput("Total    time:", loaderTime + checkerTime + codegenTime);
 
-			Console.ForegroundColor = .Green;
-			Console.Write("SUCCESS");
 			Console.ResetColor();
-			Console.WriteLine(": Build completed with no errors.");
 
-			for (let file in buildResult.Value.Files)
+			// ----------------------------------------------
+			// Release build through the system's C compiler
+			// ----------------------------------------------
+			let exePath = scope String();
+			bool releaseFailed = false;
+			if (args.Release && !writeFailed)
 			{
-				let outputDir = Path.Combine(.. scope .(), outputDirectory, scope $"{file.Name}");
-				File.WriteAllText(outputDir, file.Text);
+				NativeCompiler.GetExecutablePath(args.MainFile, outputDirectory, exePath);
+
+				// Nothing was generated when the build was up to date, so go by what's on disk.
+				let diskFiles = scope List<CFile>();
+				defer diskFiles.ClearAndDeleteItems();
+				if (builder.UpToDate)
+					read_output_files(outputDirectory, diskFiles);
+
+				let native = scope NativeCompiler();
+				releaseFailed = native.Build(builder.UpToDate ? diskFiles : buildResult.Value.Files, outputDirectory, exePath, builder.Profiler) case .Err;
+
+				writeTimeOutput("C compile time:", native.CompileTime.TotalSeconds);
+				writeTimeOutput("C link    time:", native.LinkTime.TotalSeconds);
+
+				Console.ForegroundColor = .DarkGray;
+				if (!releaseFailed)
+					Console.WriteLine(scope $"Built {exePath} with {native.CompilerPath}");
+				Console.ResetColor();
 			}
 
-			if (args.RunAfterBuild)
+			if (writeFailed)
+			{
+				Console.ForegroundColor = .Red;
+				Console.WriteLine("Build failed, the output files couldn't be written.");
+			}
+			else if (releaseFailed)
+			{
+				Console.ForegroundColor = .Red;
+				Console.WriteLine("Release build failed.");
+			}
+			else
 			{
-				execute_c_code(buildResult.Value.MainFile.Text, outputDirectory);
+				Console.ForegroundColor = .Green;
+				Console.Write("SUCCESS");
+				Console.ResetColor();
+				Console.WriteLine(": Build completed with no errors.");
+
+				if (args.RunAfterBuild && args.Release)
+				{
+					// Before running, same as with TinyCC.
+					if (args.Profile)
+						write_profile(builder.Profiler, outputDirectory);
+
+					NativeCompiler.Run(exePath).IgnoreError();
+				}
+				else if (args.RunAfterBuild)
+				{
+					if (builder.UpToDate)
+					{
+						execute_output_directory(outputDirectory, builder.Profiler);
+					}
+					else
+					{
+						execute_c_code(buildResult.Value.Files, outputDirectory, builder.Profiler);
+					}
+				}
 			}
+
+			if (args.Profile && !args.RunAfterBuild)
+				write_profile(builder.Profiler, outputDirectory);
 		}
 		else
 		{
@@ -144,50 +282,170 @@ class Program
 		}
 	}
 
-	private static void execute_c_code(String code, String includePath)
+	private static void execute_c_code(List<CFile> files, String includePath, Profiler profiler)
 	{
-		mixin fail(String msg)
+		let runtime = scope TccRuntime();
+		let loadResult = runtime.Load(files, includePath, profiler);
+
+		// Before running, the program might never return.
+		if (profiler.Enabled)
+			write_profile(profiler, includePath);
+
+		if (loadResult case .Ok)
 		{
-			Console.ForegroundColor = .DarkRed;
-			Console.WriteLine(msg);
-			Console.ResetColor();
-			return;
+			runtime.RunMain();
 		}
+	}
 
-		let tccPath = Path.Combine(.. scope .(), Directory.GetCurrentDirectory(.. scope .()), "vendor", "libtcc", "vendor", "tcc");
-
-		let compiler = scope libtcc.TCCCompiler(tccPath);
+	/// Runs what's already on disk, for when nothing was built this time.
+	private static void execute_output_directory(String outputDirectory, Profiler profiler)
+	{
+		let files = read_output_files(outputDirectory, .. scope .());
+		defer files.ClearAndDeleteItems();
 
-		compiler.AddIncludePath(includePath);
-		c_raylib_add(compiler);
+		execute_c_code(files, outputDirectory, profiler);
+	}
 
-		if (compiler.CompileString(code) == -1)
+	/// Reads the generated files back from disk.
+	private static void read_output_files(String outputDirectory, List<CFile> outFiles)
+	{
+		for (let entry in Directory.EnumerateFiles(outputDirectory))
 		{
-			fail!("TinyCC compilation failed");
+			let name = entry.GetFileName(.. scope .());
+			if (!name.EndsWith(".c") && !name.EndsWith(".h"))
+				continue;
+
+			let text = File.ReadAllText(entry.GetFilePath(.. scope .()), .. scope .());
+			outFiles.Add(new .(name, text));
 		}
-		if (compiler.Relocate(libtcc.Bindings.TccRealocateConst.TCC_RELOCATE_AUTO) < 0)
+	}
+
+	/// Keeps the builder and the TCC state alive, rebuilding whenever one of the loaded source files changes.
+	/// With '-run' the new code replaces the old one in place, a program with a 'hot_update' function keeps running across edits.
+	private static void run_watch(CLIArguments args)
+	{
+		// @TEMP
+		let mainFileDirectory = Path.GetDirectoryPath(args.MainFile, .. scope .());
+		let outputDirectory = Path.Combine(.. scope .(), mainFileDirectory, "output", "src");
+
+		let context = fill_build_context(args, .. scope .());
+
+		let builder = scope Builder();
+		let runtime = scope TccRuntime();
+		let writeTimes = scope Dictionary<String, DateTime>();
+		defer { DeleteDictionaryAndKeys!(writeTimes); }
+
+		bool hotRunning = false;
+
+		while (true)
 		{
-			fail!("Relocation failed");
-		}
+			outputFiles.ClearAndDeleteItems();
 
-		// let addSymbol = compiler.GetSymbol("add");
-		// let mulSymbol = compiler.GetSymbol("mul");
-		// let messageSymbol = compiler.GetSymbol("message");
-		let mainSymbol = compiler.GetSymbol("main");
+			let buildResult = builder.Run(args.MainFile, outputDirectory, outputFiles, context);
 
-		if (mainSymbol == null)
+			Console.ResetColor();
+			builder.RenderDiagnostics();
+
+			// Files that couldn't be written count as a failed compile, the program on disk would be half old otherwise.
+			if (buildResult case .Ok && (builder.UpToDate || builder.WriteOutputFiles(buildResult.Value.Files, outputDirectory) case .Ok))
+			{
+
+				let totalTime = builder.StopwatchLoader.Elapsed.TotalSeconds + builder.StopwatchChecker.Elapsed.TotalSeconds + builder.StopwatchCodegen.Elapsed.TotalSeconds;
+
+				Console.ForegroundColor = .Green;
+				Console.Write(builder.UpToDate ? "UP TO DATE" : "REBUILT");
+				Console.ForegroundColor = .DarkGray;
+				Console.WriteLine(scope $" {totalTime.ToString(.. scope .(), "0.00000", CultureInfo.InvariantCulture)}s, {builder.CacheMisses} of {builder.CacheHits + builder.CacheMisses} files parsed");
+				Console.ResetColor();
+
+				if (args.Profile && !args.RunAfterBuild)
+					write_profile(builder.Profiler, outputDirectory);
+
+				if (args.RunAfterBuild && (!builder.UpToDate || !runtime.IsLoaded))
+				{
+					let diskFiles = scope List<CFile>();
+					defer diskFiles.ClearAndDeleteItems();
+
+					if (builder.UpToDate)
+						read_output_files(outputDirectory, diskFiles);
+
+					let files = builder.UpToDate ? diskFiles : buildResult.Value.Files;
+					let loadResult = runtime.Load(files, outputDirectory, builder.Profiler);
+					if (args.Profile)
+						write_profile(builder.Profiler, outputDirectory);
+
+					if (loadResult case .Ok)
+					{
+						if (hotRunning && runtime.HasHotUpdate)
+						{
+							runtime.Reload();
+						}
+						else
+						{
+							runtime.RunMain();
+							hotRunning = runtime.HasHotUpdate;
+						}
+					}
+				}
+			}
+			else
+			{
+				Console.ForegroundColor = .Red;
+				Console.WriteLine("Compile failed, waiting for changes...");
+				Console.ResetColor();
+			}
+
+			snapshotWriteTimes(builder, writeTimes);
+
+			// Wait for an edit, driving the hot program in the meantime.
+			let pollTimer = scope System.Diagnostics.Stopwatch()..Start();
+			while (true)
+			{
+				if (pollTimer.ElapsedMilliseconds >= 250)
+				{
+					if (writeTimesChanged(writeTimes))
+						break;
+					pollTimer.Reset();
+					pollTimer.Start();
+				}
+
+				if (hotRunning)
+				{
+					if (!runtime.HotUpdate())
+						return;
+				}
+				else
+				{
+					Thread.Sleep(50);
+				}
+			}
+		}
+	}
+
+	private static void snapshotWriteTimes(Builder builder, Dictionary<String, DateTime> writeTimes)
+	{
+		for (let path in writeTimes.Keys)
 		{
-			fail!("The main symbol couldn't be found, so we can't run the program!");
+			delete path;
 		}
+		writeTimes.Clear();
+
+		for (let file in builder.SourceFiles)
+		{
+			if (writeTimes.ContainsKey(file.Path))
+				continue;
 
-		// function int(int a, int b) add_func = (.)addSymbol;
-		// function int(int a, int b) mul_func = (.)mulSymbol;
-		// char8* msg_func = *(char8**)messageSymbol;
-		function void() main_func = (.)mainSymbol;
+			writeTimes.Add(new .(file.Path), File.GetLastWriteTimeUtc(file.Path).GetValueOrDefault());
+		}
+	}
 
-		main_func();
-		// Console.WriteLine(add_func(4, 2));
-		// Console.WriteLine(mul_func(4, 2));
-		// Console.WriteLine(scope String(msg_func));
+	private static bool writeTimesChanged(Dictionary<String, DateTime> writeTimes)
+	{
+		for (let file in writeTimes)
+		{
+			if (File.GetLastWriteTimeUtc(file.key).GetValueOrDefault() != file.value)
+				return true;
+		}
+		return false;
 	}
-}
\ No newline at end of file
+}
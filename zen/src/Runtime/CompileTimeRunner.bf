@@ -0,0 +1,326 @@
+using System;
+using System.IO;
+using System.Collections;
+using System.Diagnostics;
+
+namespace Zen;
+
+/// Runs the '#run's of a checked program while compiling it (see AstNode.Expression.Run), so work the program would've done at startup
+/// ends up in the output as constants instead.
+///
+/// The whole program gets generated (nothing stripped, and with bounds checks) along with an extra entry point (see Generator.GenerateRunner()),
+/// then TinyCC runs it like TccRuntime runs a finished program, with the globals initialized first like before main.
+/// The result of every '#run' initializer gets folded into the AST, so the Generator writes it out like any other constant.
+/// Globals with a '#run' in their initializer start out at zero here, so that '#run' is only called once.
+/// After all of the '#run's, the globals that don't have an initializer (numbers, bools and arrays of them)
+/// keep whatever they were left with, see BakedGlobals:
+///
+///     var int[256] squares;
+///     fun void build_squares() { for (var int i = 0; i < 256; i += 1) { squares[i] = i * i; } }
+///     #run build_squares();
+///
+/// Anything a '#run' does to the other globals would be lost, so that gets a warning.
+/// The program runs inside of the compiler, so a '#run' that crashes takes the build down with it.
+class CompileTimeRunner
+{
+	private typealias RunFunc = function void(int64* ints, double* floats);
+	private typealias EntryFunc = function void();
+
+	/// Next to the output's 'src', 'obj' and 'bin' directories.
+	public const String DIRECTORY_NAME = "run";
+
+	private readonly Dictionary<Entity.Variable, String> m_bakedGlobals = new .() ~ DeleteDictionaryAndValues!(_);
+
+	/// The C initializers for the globals '#run's filled in, for Generator.BakedGlobals.
+	public Dictionary<Entity.Variable, String> BakedGlobals => m_bakedGlobals;
+
+	public Event<delegate void(Diagnostic)> OnReport = default;
+
+	public Result<void> Run(List<AstNode.Expression.Run> runs, Ast ast, Scope globalScope, TypeTable types, StringView outputDirectory, WorkerPool pool, Profiler profiler)
+	{
+		let files = scope List<CFile>();
+		defer files.ClearAndDeleteItems();
+
+		// The ones that can't be baked are only watched, to warn about what a '#run' did to them.
+		let globals = scope List<Entity.Variable>();
+		collectGlobals(globalScope, globals);
+		let watched = scope List<Entity.Variable>();
+		for (let _var in globals)
+		{
+			if (!isBaked(_var))
+				watched.Add(_var);
+		}
+
+		let context = scope BuildContext() { StripDeadCode = false, BoundsChecks = true };
+		let generator = scope Generator(ast, globalScope, types, null, files, context, pool, profiler) { SkipRunInitializers = true };
+		generator.Generate();
+		generator.GenerateRunner(runs, watched);
+
+		let outputRoot = Path.GetDirectoryPath(outputDirectory, .. scope .());
+		let directory = Path.Combine(.. scope .(), outputRoot, DIRECTORY_NAME);
+		Directory.CreateDirectory(directory).IgnoreError();
+
+		// Written out, so the includes resolve and there's something to look at when a '#run' misbehaves.
+		for (let file in files)
+		{
+			let path = Path.Combine(.. scope .(), directory, file.Name);
+			if (file.WriteTo(path) case .Err)
+			{
+				reportFailure(scope $"Couldn't write {path}");
+				return .Err;
+			}
+		}
+
+		let runtime = scope TccRuntime();
+		if (runtime.Load(files, directory, profiler) case .Err)
+		{
+			reportFailure("The program couldn't be compiled for '#run'");
+			return .Err;
+		}
+
+		RunFunc run = (.)runtime.GetSymbol(Generator.RUN_SYMBOL);
+		EntryFunc initGlobals = (.)runtime.GetSymbol(Generator.INIT_GLOBALS_SYMBOL);
+		let sizes = (int64*)runtime.GetSymbol(Generator.RUN_SIZES_SYMBOL);
+		if (run == null || initGlobals == null || (sizes == null && !watched.IsEmpty))
+		{
+			reportFailure("The '#run' entry point couldn't be found");
+			return .Err;
+		}
+
+		let ints = scope int64[runs.Count];
+		let floats = scope double[runs.Count];
+		let initialValues = scope List<uint8>();
+
+		using (profiler.Begin("#run", "run"))
+		{
+			initGlobals();
+			appendGlobalMemory(runtime, watched, sizes, initialValues);
+			run(ints.Ptr, floats.Ptr);
+		}
+
+		reportLostChanges(runtime, watched, sizes, initialValues);
+
+		for (let _run in runs)
+		{
+			if (_run.IsStatement)
+				continue;
+
+			ConstantValue value;
+			if (_run.ResolvedType case .Basic(let basic) && basic.Kind == .Float64)
+				value = .Float64(floats[@_run.Index]);
+			else if (_run.ResolvedType.IsTypeFloat())
+				value = .Float(floats[@_run.Index]);
+			else if (_run.ResolvedType.IsTypeBoolean())
+				value = .Bool(ints[@_run.Index] != 0);
+			else
+				value = .Int(ints[@_run.Index]);
+
+			_run.Folded = value;
+
+			// The same conversion the Checker does for constants that fold on their own.
+			if (_run.Constant != null)
+			{
+				if (_run.Constant.ResolvedType.IsTypeNumeric() && ConstantValue.Cast(value, _run.Constant.ResolvedType) case .Ok(let converted))
+					value = converted;
+				_run.Constant.Value = value;
+			}
+		}
+
+		// Initializers can change globals too, not just statements.
+		bakeGlobals(globals, runtime);
+
+		return .Ok;
+	}
+
+	private static void collectGlobals(Scope _scope, List<Entity.Variable> outGlobals)
+	{
+		for (let entity in _scope.EntityMap)
+		{
+			if (let ns = entity.value as Entity.Namespace)
+				collectGlobals(ns.Decl.Scope, outGlobals);
+			else if (let _var = entity.value as Entity.Variable)
+				outGlobals.Add(_var);
+		}
+	}
+
+	/// Ones with an initializer get it run again at startup anyway.
+	private static bool isBaked(Entity.Variable _var)
+	{
+		return _var.Decl.Initializer == null && isBakeable(_var.ResolvedType);
+	}
+
+	private static void appendGlobalMemory(TccRuntime runtime, List<Entity.Variable> globals, int64* sizes, List<uint8> outBytes)
+	{
+		for (let _var in globals)
+		{
+			let address = (uint8*)runtime.GetSymbol(Generator.GetGlobalName(_var, .. scope .()));
+			if (address != null)
+				outBytes.AddRange(Span<uint8>(address, (int)sizes[@_var.Index]));
+		}
+	}
+
+	/// Warns about every global that isn't what it was initialized to anymore, since the program won't start with that.
+	private void reportLostChanges(TccRuntime runtime, List<Entity.Variable> globals, int64* sizes, List<uint8> initialValues)
+	{
+		int offset = 0;
+		for (let _var in globals)
+		{
+			let address = (uint8*)runtime.GetSymbol(Generator.GetGlobalName(_var, .. scope .()));
+			if (address == null)
+				continue;
+
+			let size = (int)sizes[@_var.Index];
+			if (Internal.MemCmp(address, initialValues.Ptr + offset, size) != 0)
+			{
+				if (_var.Decl.Initializer != null)
+					reportWarning(_var, scope $"A '#run' changed '{_var.Decl.Name.Lexeme}', but it has an initializer, so the program still starts out with that");
+				else
+					reportWarning(_var, scope $"A '#run' changed '{_var.Decl.Name.Lexeme}', but only numbers, bools and arrays of them keep what a '#run' left in them");
+			}
+			offset += size;
+		}
+	}
+
+	private void bakeGlobals(List<Entity.Variable> globals, TccRuntime runtime)
+	{
+		for (let _var in globals)
+		{
+			if (!isBaked(_var))
+				continue;
+
+			let address = runtime.GetSymbol(Generator.GetGlobalName(_var, .. scope .()));
+			if (address == null)
+				continue;
+
+			// Left alone if it's still all zeroes, that's what C starts it at anyway.
+			let initializer = new String();
+			if (appendValue(_var.ResolvedType, (uint8*)address, initializer))
+				m_bakedGlobals.Add(_var, initializer);
+			else
+				delete initializer;
+		}
+	}
+
+	private static bool isBakeable(ZenType type)
+	{
+		switch (type)
+		{
+		case .Basic(let basic):
+			return getSize(basic.Kind) > 0;
+		case .Array(let arr):
+			return !arr.SoA && arr.Count != ArrayType.UNKNOWN_COUNT && isBakeable(*arr.Element);
+		default:
+			return false;
+		}
+	}
+
+	/// How big the C type is, or 0 when it can't be baked.
+	private static int getSize(BasicKind kind)
+	{
+		switch (kind)
+		{
+		case .Bool, .Int8, .UInt8:
+			return 1;
+		case .Int16, .UInt16:
+			return 2;
+		case .Int, .Int32, .UInt, .UInt32, .Float32:
+			return 4;
+		case .Int64, .UInt64, .Float64:
+			return 8;
+		default:
+			return 0;
+		}
+	}
+
+	private static int getSize(ZenType type)
+	{
+		switch (type)
+		{
+		case .Basic(let basic):
+			return getSize(basic.Kind);
+		case .Array(let arr):
+			return arr.Count * getSize(*arr.Element);
+		default:
+			return 0;
+		}
+	}
+
+	/// Spells the value at address as a C initializer, returns whether anything in it isn't zero.
+	private static bool appendValue(ZenType type, uint8* address, String outStr)
+	{
+		switch (type)
+		{
+		case .Basic(let basic):
+			return appendBasic(basic.Kind, address, outStr);
+		case .Array(let arr):
+			let elementSize = getSize(*arr.Element);
+			bool nonZero = false;
+
+			outStr.Append("{ ");
+			for (int i < arr.Count)
+			{
+				if (i > 0)
+					outStr.Append(", ");
+				nonZero |= appendValue(*arr.Element, address + i * elementSize, outStr);
+			}
+			outStr.Append(" }");
+			return nonZero;
+		default:
+			Runtime.FatalError("Only bakeable types get here");
+		}
+	}
+
+	private static bool appendBasic(BasicKind kind, uint8* address, String outStr)
+	{
+		ConstantValue value;
+		switch (kind)
+		{
+		case .Bool:    value = .Bool(*(bool*)address);
+		case .Int8:    value = .Int(*(int8*)address);
+		case .Int16:   value = .Int(*(int16*)address);
+		case .Int, .Int32: value = .Int(*(int32*)address);
+		case .Int64:   value = .Int(*(int64*)address);
+		case .UInt8:   value = .Int(*(uint8*)address);
+		case .UInt16:  value = .Int(*(uint16*)address);
+		case .UInt, .UInt32: value = .Int(*(uint32*)address);
+		case .UInt64:
+			let bits = *(uint64*)address;
+			outStr.Append(scope $"{bits}ULL");
+			return bits != 0;
+		case .Float32:
+			let single = *(float*)address;
+			ConstantValue.AppendFloat(single, outStr, "f");
+			return single != 0;
+		case .Float64:
+			let wide = *(double*)address;
+			ConstantValue.AppendFloat(wide, outStr, "");
+			return wide != 0;
+		default:
+			Runtime.FatalError("Only bakeable types get here");
+		}
+
+		value.ToC(outStr);
+		switch (value)
+		{
+		case .Int(let i):     return i != 0;
+		case .Float(let f):   return f != 0;
+		case .Float64(let f): return f != 0;
+		case .Bool(let b):    return b;
+		}
+	}
+
+	private void reportWarning(Entity.Variable _var, String msg)
+	{
+		Debug.Assert(OnReport != default);
+
+		let diag = new Diagnostic(.Warning, msg, new DiagnosticSpan() { Range = _var.Decl.Name.SourceRange });
+		OnReport(diag);
+	}
+
+	private static void reportFailure(StringView msg)
+	{
+		Console.ForegroundColor = .DarkRed;
+		Console.WriteLine(msg);
+		Console.ResetColor();
+	}
+}
@@ -0,0 +1,45 @@
+using System;
+using System.Collections;
+
+namespace Zen;
+
+/// The host's functions that generated code can call (raylib, see c_raylib_add_symbols()), handed to every TinyCC state.
+/// Collected once per process, so reloading in watch mode (or running more than once) only has to copy the table over.
+class HostSymbols
+{
+	private static HostSymbols s_instance = null ~ delete _;
+
+	/// The names are all string literals, so they outlive the table.
+	private readonly List<(StringView name, void* address)> m_symbols = new .() ~ delete _;
+
+	public int Count => m_symbols.Count;
+
+	public static HostSymbols Get()
+	{
+		if (s_instance == null)
+		{
+			s_instance = new .();
+			c_raylib_add_symbols(s_instance);
+		}
+
+		return s_instance;
+	}
+
+	public void AddSymbol(StringView name, void* address)
+	{
+		m_symbols.Add((name, address));
+	}
+
+	public void AddSymbol(StringView name, Delegate del)
+	{
+		AddSymbol(name, del.GetFuncPtr());
+	}
+
+	public void AddTo(libtcc.TCCCompiler compiler)
+	{
+		for (let symbol in m_symbols)
+		{
+			compiler.AddSymbol(symbol.name, symbol.address);
+		}
+	}
+}
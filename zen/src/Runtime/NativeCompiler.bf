@@ -0,0 +1,224 @@
+using System;
+using System.IO;
+using System.Collections;
+using System.Diagnostics;
+
+namespace Zen;
+
+/// Builds the generated C into an executable with the system's optimizing C compiler, for shipping instead of running through TinyCC.
+/// Uses $CC when it's set, otherwise 'cc' ('clang' on Windows). Every translation unit gets compiled at the same time,
+/// then the link does the actual optimizing (-flto), so functions get inlined across the files '-split' puts namespaces in.
+///
+/// raylib gets linked in statically, from the first of these that exists:
+///     $RAYLIB_LIB                                                  - the library file itself
+///     vendor/lib/libraylib.a (raylib.lib on Windows)
+///     vendor/raylib-beef/raylib-beef/dist/linux/libraylib.a       - the one the raylib-beef dependency ships (dist/x64/raylib.lib on Windows)
+class NativeCompiler
+{
+#if BF_PLATFORM_WINDOWS
+	private const String DEFAULT_COMPILER = "clang";
+	private const String EXECUTABLE_EXTENSION = ".exe";
+	private const String PLATFORM_LIBRARIES = "-lgdi32 -lwinmm -lopengl32";
+	private const String RAYLIB_FILE_NAME = "raylib.lib";
+	private const String RAYLIB_DIST_DIRECTORY = "x64";
+#else
+	private const String DEFAULT_COMPILER = "cc";
+	private const String EXECUTABLE_EXTENSION = "";
+	private const String PLATFORM_LIBRARIES = "-lm -lpthread -ldl";
+	private const String RAYLIB_FILE_NAME = "libraylib.a";
+	private const String RAYLIB_DIST_DIRECTORY = "linux";
+#endif
+
+	/// No -fno-strict-aliasing, the generated code has to hold up under the optimizer as-is.
+	private const String COMPILE_FLAGS = "-O3 -march=native -flto";
+	private const String LINK_FLAGS = "-O3 -march=native -flto";
+
+	private readonly String m_compilerPath = new .() ~ delete _;
+	private readonly String m_vendorPath = new .() ~ delete _;
+
+	public TimeSpan CompileTime { get; private set; }
+	public TimeSpan LinkTime { get; private set; }
+
+	public StringView CompilerPath => m_compilerPath;
+
+	public this()
+	{
+		Environment.GetEnvironmentVariable("CC", m_compilerPath);
+		if (m_compilerPath.IsEmpty)
+			m_compilerPath.Set(DEFAULT_COMPILER);
+
+		Path.Combine(m_vendorPath, Directory.GetCurrentDirectory(.. scope .()), "vendor");
+	}
+
+	/// Where the executable for a main file goes, next to the generated sources' directory.
+	public static void GetExecutablePath(StringView mainFile, StringView outputDirectory, String outPath)
+	{
+		let name = Path.GetFileNameWithoutExtension(mainFile, .. scope .());
+		let outputRoot = Path.GetDirectoryPath(outputDirectory, .. scope .());
+		Path.Combine(outPath, outputRoot, "bin", scope $"{name}{EXECUTABLE_EXTENSION}");
+	}
+
+	/// Compiles the files written to sourceDirectory and links them (with raylib) into exePath.
+	/// The compiler's own output goes straight to the console.
+	public Result<void> Build(List<CFile> files, StringView sourceDirectory, StringView exePath, Profiler profiler)
+	{
+		let outputRoot = Path.GetDirectoryPath(sourceDirectory, .. scope .());
+		let objectDirectory = Path.Combine(.. scope .(), outputRoot, "obj");
+		Directory.CreateDirectory(objectDirectory).IgnoreError();
+		Directory.CreateDirectory(Path.GetDirectoryPath(exePath, .. scope .())).IgnoreError();
+
+		// Before compiling anything, so a missing library doesn't show up as some link error afterwards.
+		let raylibPath = scope String();
+		Try!(findRaylib(raylibPath));
+
+		let includePath = Path.Combine(.. scope .(), m_vendorPath, "include");
+
+		let objects = scope List<String>();
+		defer objects.ClearAndDeleteItems();
+
+		// ----------------------------------------------
+		// Compile, every file at once
+		// ----------------------------------------------
+		let stopwatch = scope Stopwatch()..Start();
+		let compileZone = profiler.Begin("CC compile", "native");
+
+		let processes = scope List<(StringView name, SpawnedProcess process)>();
+		defer { for (let entry in processes) delete entry.process; }
+
+		bool failed = false;
+		for (let file in files)
+		{
+			if (!file.IsTranslationUnit)
+				continue;
+
+			let source = Path.Combine(.. scope .(), sourceDirectory, file.Name);
+			let objectName = scope String(file.Name)..Append(".o");
+			let object = Path.Combine(.. new .(), objectDirectory, objectName);
+			objects.Add(object);
+
+			let arguments = scope $"{COMPILE_FLAGS} -I\"{sourceDirectory}\" -I\"{includePath}\" -c \"{source}\" -o \"{object}\"";
+			if (spawn(arguments) case .Ok(let process))
+				processes.Add((file.Name, process));
+			else
+				failed = true;
+		}
+
+		for (let entry in processes)
+		{
+			entry.process.WaitFor();
+			if (entry.process.ExitCode != 0)
+			{
+				reportFailure(scope $"{m_compilerPath} failed to compile {entry.name}");
+				failed = true;
+			}
+		}
+
+		compileZone.Count("files", objects.Count);
+		compileZone.Dispose();
+		CompileTime = stopwatch.Elapsed;
+
+		if (failed)
+			return .Err;
+
+		// ----------------------------------------------
+		// Link (this is where -flto optimizes)
+		// ----------------------------------------------
+		stopwatch.Restart();
+		let linkZone = profiler.Begin("CC link", "native");
+
+		let arguments = scope String(LINK_FLAGS);
+		for (let object in objects)
+		{
+			arguments.Append(scope $" \"{object}\"");
+		}
+		arguments.Append(scope $" -o \"{exePath}\" \"{raylibPath}\" {PLATFORM_LIBRARIES}");
+
+		int32 exitCode = -1;
+		if (spawn(arguments) case .Ok(let process))
+		{
+			process.WaitFor();
+			exitCode = process.ExitCode;
+			delete process;
+		}
+
+		linkZone.Dispose();
+		LinkTime = stopwatch.Elapsed;
+
+		if (exitCode != 0)
+		{
+			reportFailure(scope $"{m_compilerPath} failed to link {exePath}");
+			return .Err;
+		}
+
+		return .Ok;
+	}
+
+	/// Where the raylib library to link is, see the class comment for where it's looked for.
+	private Result<void> findRaylib(String outPath)
+	{
+		Environment.GetEnvironmentVariable("RAYLIB_LIB", outPath);
+		if (!outPath.IsEmpty)
+		{
+			if (File.Exists(outPath))
+				return .Ok;
+
+			reportFailure(scope $"raylib library not found: RAYLIB_LIB is set to '{outPath}', which doesn't exist");
+			return .Err;
+		}
+
+		Path.Combine(outPath, m_vendorPath, "lib", RAYLIB_FILE_NAME);
+		if (File.Exists(outPath))
+			return .Ok;
+
+		outPath.Clear();
+		Path.Combine(outPath, m_vendorPath, "raylib-beef", "raylib-beef", "dist", RAYLIB_DIST_DIRECTORY, RAYLIB_FILE_NAME);
+		if (File.Exists(outPath))
+			return .Ok;
+
+		reportFailure(scope $"raylib library not found: set RAYLIB_LIB to {RAYLIB_FILE_NAME}, or put it in {m_vendorPath}/lib");
+		return .Err;
+	}
+
+	/// Runs a built executable and waits for it to quit.
+	public static Result<void> Run(StringView exePath)
+	{
+		let info = scope ProcessStartInfo();
+		info.UseShellExecute = false;
+		info.SetFileName(exePath);
+
+		let process = scope SpawnedProcess();
+		if (process.Start(info) case .Err)
+		{
+			reportFailure(scope $"Couldn't start {exePath}");
+			return .Err;
+		}
+
+		process.WaitFor();
+		return .Ok;
+	}
+
+	private Result<SpawnedProcess> spawn(StringView arguments)
+	{
+		let info = scope ProcessStartInfo();
+		info.UseShellExecute = false;
+		info.SetFileName(m_compilerPath);
+		info.SetArguments(arguments);
+
+		let process = new SpawnedProcess();
+		if (process.Start(info) case .Err)
+		{
+			reportFailure(scope $"Couldn't run the C compiler '{m_compilerPath}', set CC to the one to use");
+			delete process;
+			return .Err;
+		}
+
+		return process;
+	}
+
+	private static void reportFailure(StringView msg)
+	{
+		Console.ForegroundColor = .DarkRed;
+		Console.WriteLine(msg);
+		Console.ResetColor();
+	}
+}
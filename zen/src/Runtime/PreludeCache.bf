@@ -0,0 +1,116 @@
+using System;
+using System.IO;
+
+namespace Zen;
+
+/// raylib.h is mostly documentation, and TinyCC has to read through all of it every time it loads a program.
+/// This keeps a copy on disk with only the code left in it (no comments, indentation or blank lines), under a hash of the original.
+/// Its directory goes ahead of the real headers on the include path, so the '#include <raylib.h>' in zen.h picks up the copy.
+/// An edited header hashes differently and gets a fresh copy.
+static class PreludeCache
+{
+	/// Next to the output's 'src', 'obj' and 'bin' directories.
+	public const String DIRECTORY_NAME = "prelude";
+
+	private const String HEADER_NAME = "raylib.h";
+
+	/// Bump this whenever strip() changes, so old copies don't get used.
+	private const int VERSION = 1;
+
+	/// Gets the directory the stripped header is in for an output, writing the header first if it isn't there yet.
+	public static Result<void> GetIncludePath(StringView outputRoot, String outPath)
+	{
+		let headerPath = Path.Combine(.. scope .(), c_raylib_include_path(.. scope .()), HEADER_NAME);
+		let header = scope String();
+		if (File.ReadAllText(headerPath, header) case .Err)
+			return .Err;
+
+		let hash = BuildCache.Hash(header, BuildCache.Hash(scope $"prelude {VERSION}"));
+		let cacheDirectory = Path.Combine(.. scope .(), outputRoot, DIRECTORY_NAME);
+		let directory = Path.Combine(.. scope .(), cacheDirectory, scope $"{hash}");
+		let cachedPath = Path.Combine(.. scope .(), directory, HEADER_NAME);
+
+		if (!File.Exists(cachedPath))
+		{
+			let stripped = scope String(header.Length);
+			strip(header, stripped);
+
+			Directory.CreateDirectory(cacheDirectory).IgnoreError();
+			Directory.CreateDirectory(directory).IgnoreError();
+
+			// Written next to it first, so a build that dies halfway doesn't leave a cut off copy behind.
+			let tempPath = scope $"{cachedPath}.tmp";
+			if (File.WriteAllText(tempPath, stripped) case .Err)
+				return .Err;
+			if (File.Move(tempPath, cachedPath) case .Err)
+			{
+				File.Delete(tempPath).IgnoreError();
+				return .Err;
+			}
+		}
+
+		outPath.Append(directory);
+		return .Ok;
+	}
+
+	/// Drops comments, the whitespace around every line and empty lines (unless a '\' continues a directive into one).
+	/// Comments become a space like they do for the preprocessor, string and char literals are copied as they are.
+	private static void strip(StringView text, String outText)
+	{
+		let line = scope String();
+
+		mixin endLine()
+		{
+			line.Trim();
+			if (!line.IsEmpty || outText.EndsWith("\\\n"))
+			{
+				outText.Append(line);
+				outText.Append('\n');
+			}
+			line.Clear();
+		}
+
+		int i = 0;
+		while (i < text.Length)
+		{
+			let c = text[i];
+			let next = (i + 1 < text.Length) ? text[i + 1] : '\0';
+
+			if (c == '"' || c == '\'')
+			{
+				int end = i + 1;
+				while (end < text.Length && text[end] != c && text[end] != '\n')
+					end += (text[end] == '\\') ? 2 : 1;
+				end = Math.Min(end + 1, text.Length);
+
+				line.Append(text.Substring(i, end - i));
+				i = end;
+			}
+			else if (c == '/' && next == '/')
+			{
+				while (i < text.Length && text[i] != '\n')
+					i++;
+			}
+			else if (c == '/' && next == '*')
+			{
+				i += 2;
+				while (i < text.Length && !(text[i] == '*' && i + 1 < text.Length && text[i + 1] == '/'))
+					i++;
+				i += 2;
+				line.Append(' ');
+			}
+			else if (c == '\n')
+			{
+				endLine!();
+				i++;
+			}
+			else
+			{
+				line.Append(c);
+				i++;
+			}
+		}
+
+		endLine!();
+	}
+}
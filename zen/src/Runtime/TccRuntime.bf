@@ -0,0 +1,158 @@
+using System;
+using System.IO;
+using System.Collections;
+
+namespace Zen;
+
+/// Owns the TinyCC state that the generated code lives in.
+/// New code gets compiled and relocated into a fresh state, and only replaces the current one if that worked,
+/// so a broken edit leaves the running program alone.
+///
+/// A program can opt into hot reloading by declaring these at the global scope:
+///     fun bool hot_update()  - called once per frame by the host, return false to quit.
+///     fun void hot_reload()  - called after new code was swapped in and its globals were initialized.
+class TccRuntime
+{
+	private typealias MainFunc = function int32();
+	private typealias EntryFunc = function void();
+	private typealias UpdateFunc = function bool();
+
+	private libtcc.TCCCompiler m_compiler = null ~ delete _;
+	private readonly String m_tccPath = new .() ~ delete _;
+
+	private MainFunc m_main = null;
+	private EntryFunc m_initGlobals = null;
+	private EntryFunc m_hotReload = null;
+	private UpdateFunc m_hotUpdate = null;
+
+	private int m_loadCount = 0;
+
+	public bool IsLoaded => m_compiler != null;
+	public bool HasHotUpdate => m_hotUpdate != null;
+
+	/// How many times code was successfully loaded into this runtime.
+	public int LoadCount => m_loadCount;
+
+	public this()
+	{
+		Path.Combine(m_tccPath, Directory.GetCurrentDirectory(.. scope .()), "vendor", "libtcc", "vendor", "tcc");
+	}
+
+	/// Compiles every C file of the output and relocates them into a new state, then swaps it in.
+	/// The old state (and all of its globals) is freed, so this must not be called from inside the loaded code.
+	public Result<void> Load(List<CFile> files, StringView includePath, Profiler profiler)
+	{
+		let compiler = new libtcc.TCCCompiler(m_tccPath);
+
+		mixin fail(String msg)
+		{
+			Console.ForegroundColor = .DarkRed;
+			Console.WriteLine(msg);
+			Console.ResetColor();
+
+			delete compiler;
+			return .Err;
+		}
+
+		compiler.AddIncludePath(includePath);
+
+		let preludeZone = profiler.Begin("TCC prelude", "tcc");
+
+		// Has to come before raylib's own include path to be picked up. Without it the full header still works, just slower.
+		let outputRoot = Path.GetDirectoryPath(includePath, .. scope .());
+		let preludePath = scope String();
+		if (PreludeCache.GetIncludePath(outputRoot, preludePath) case .Ok)
+			compiler.AddIncludePath(preludePath);
+
+		c_raylib_add(compiler);
+		preludeZone.Count("hostSymbols", HostSymbols.Get().Count);
+		preludeZone.Dispose();
+
+		// TinyCC can't keep parsed headers around, so every translation unit goes in as a single one instead.
+		// That way zen.h (and raylib.h through it) only gets parsed once per load, not once per file.
+		// The '#line's keep errors pointing at the right file.
+		let unity = scope String();
+		int unitCount = 0;
+		for (let file in files)
+		{
+			if (!file.IsTranslationUnit)
+				continue;
+
+			unity.Append(scope $"#line 1 \"{file.Name}\"\n");
+			unity.Append(file.Text);
+			unity.Append('\n');
+			unitCount++;
+		}
+
+		let compileZone = profiler.Begin("TCC compile", "tcc");
+		let compileResult = compiler.CompileString(unity);
+		compileZone.Count("files", unitCount);
+		compileZone.Count("bytes", unity.Length);
+		compileZone.Dispose();
+
+		if (compileResult == -1)
+		{
+			fail!("TinyCC compilation failed");
+		}
+
+		let relocateZone = profiler.Begin("TCC relocate", "tcc");
+		let relocateResult = compiler.Relocate(libtcc.Bindings.TccRealocateConst.TCC_RELOCATE_AUTO);
+		relocateZone.Dispose();
+
+		if (relocateResult < 0)
+		{
+			fail!("Relocation failed");
+		}
+
+		MainFunc main = (.)compiler.GetSymbol("main");
+		EntryFunc initGlobals = (.)compiler.GetSymbol(Generator.INIT_GLOBALS_SYMBOL);
+
+		if (main == null || initGlobals == null)
+		{
+			fail!("The main symbol couldn't be found, so we can't run the program!");
+		}
+
+		delete m_compiler;
+		m_compiler = compiler;
+
+		m_main = main;
+		m_initGlobals = initGlobals;
+		m_hotUpdate = (.)compiler.GetSymbol(scope $"{Generator.USER_SYMBOL_PREFIX}_hot_update");
+		m_hotReload = (.)compiler.GetSymbol(scope $"{Generator.USER_SYMBOL_PREFIX}_hot_reload");
+
+		m_loadCount++;
+
+		return .Ok;
+	}
+
+	/// Runs the generated C entry point, which initializes the globals and calls the program's main.
+	public void RunMain()
+	{
+		Runtime.Assert(IsLoaded);
+		m_main();
+	}
+
+	/// Re-initializes the globals of freshly swapped in code without going through main again.
+	public void Reload()
+	{
+		Runtime.Assert(IsLoaded);
+		m_initGlobals();
+
+		if (m_hotReload != null)
+			m_hotReload();
+	}
+
+	/// Where a symbol of the loaded code is, null if there's no such symbol.
+	public void* GetSymbol(StringView name)
+	{
+		Runtime.Assert(IsLoaded);
+		return m_compiler.GetSymbol(name);
+	}
+
+	/// Runs a single frame of a hot reloadable program, returns false once the program wants to quit.
+	public bool HotUpdate()
+	{
+		Runtime.Assert(HasHotUpdate);
+		return m_hotUpdate();
+	}
+}
@@ -9,11 +9,20 @@ class Binder : Visitor
 {
 	private readonly Ast m_ast;
 
-	private readonly Scope m_globalScope ~ delete _;
+	/// Owns every scope and entity, they're referenced from all over the place until the build is done.
+	private readonly BumpAllocator m_alloc = new .() ~ delete _;
+
+	private readonly Scope m_globalScope;
 	private Scope m_currentScope;
 
 	private List<Namespace> m_namespaceStackFileScope = new .() ~ delete _;
 
+	private int m_entityCount = 0;
+
+	/// Entities declared by Run(), for the profiler.
+	public int EntityCount => m_entityCount;
+	public int AllocatedBytes => m_alloc.GetAllocSize();
+
 	private struct Namespace
 	{
 		public AstNode.Stmt.NamespaceDeclaration Node;
@@ -24,26 +33,26 @@ class Binder : Visitor
 	{
 		this.m_ast = ast;
 
-		m_globalScope = new Scope("Global Scope", null, null);
+		m_globalScope = new:m_alloc Scope("Global Scope", null, null);
 		m_currentScope = m_globalScope;
 
-		addGlobalConstant("null", .Basic(BasicType.FromKind(.UntypedNull)), default);
-		addGlobalConstant("true", .Basic(BasicType.FromKind(.UntypedBool)), Variant.Create<bool>(true));
-		addGlobalConstant("false", .Basic(BasicType.FromKind(.UntypedBool)), Variant.Create<bool>(false));
+		addGlobalConstant("null", .Basic(BasicType.FromKind(.UntypedNull)), null);
+		addGlobalConstant("true", .Basic(BasicType.FromKind(.UntypedBool)), .Bool(true));
+		addGlobalConstant("false", .Basic(BasicType.FromKind(.UntypedBool)), .Bool(false));
 
 		// Built in functions
 		for (let fun in BuiltinFunctions)
 		{
 			let token = Token(.Identifier);
-			let entity = new Entity.Builtin(m_globalScope, fun.Name, token, fun.TempType);
+			let entity = new:m_alloc Entity.Builtin(m_globalScope, fun.Name, token, fun.TempType);
 			m_globalScope.DeclareWithName(entity, fun.Name);
 		}
 	}
 
-	private void addGlobalConstant(String name, ZenType type, Variant value)
+	private void addGlobalConstant(String name, ZenType type, ConstantValue? value)
 	{
 		let token = Token(.Identifier);
-		let entity = new Entity.Constant(m_globalScope, .Builtin, null, value, token, type);
+		let entity = new:m_alloc Entity.Constant(m_globalScope, .Builtin, null, value, token, type);
 		m_globalScope.DeclareWithName(entity, name);
 	}
 
@@ -75,7 +84,7 @@ class Binder : Visitor
 			if (!createScope)
 				return m_currentScope;
 
-			let newScope = new Scope(name, m_currentScope, getNamespaceParent());
+			let newScope = new:m_alloc Scope(name, m_currentScope, getNamespaceParent());
 			statement.Scope = newScope;
 			m_currentScope = newScope;
 			return newScope;
@@ -96,10 +105,11 @@ class Binder : Visitor
 			return m_currentScope;
 		}
 
-		if (let namespc = node as AstNode.Stmt.NamespaceDeclaration)
+		switch (node.GetKind())
 		{
+		case .NamespaceDecl(let namespc):
 			// Look if this namespace entity already exists, and if it does, we can just "piggyback" on this one.
-			if (m_currentScope.LookupName<Entity.Namespace>(namespc.Name.Lexeme) case .Ok(let res))
+			if (m_currentScope.LookupName<Entity.Namespace>(namespc.Name.Symbol) case .Ok(let res))
 			{
 				enterExistingScope(res.Decl.Scope);
 
@@ -119,7 +129,7 @@ class Binder : Visitor
 			}
 			else
 			{
-				let entity = new Entity.Namespace(m_currentScope, namespc, namespc.Name, .Namespace(namespc));
+				let entity = new:m_alloc Entity.Namespace(m_currentScope, namespc, namespc.Name, .Namespace(namespc));
 				scope_tryDeclare(m_currentScope, namespc.Name, entity, namespc);
 
 				openNewScope(scope $"Namespace ({namespc.Name.Lexeme})", namespc);
@@ -134,27 +144,21 @@ class Binder : Visitor
 				m_namespaceStackFileScope.Clear();
 				closeScope();
 			}
-		}
 
 		/*
-		if (node is AstNode.Stmt.EOF)
-		{
+		case .EOF:
 			for (let ns in m_namespaceStackFileScope)
 			{
 				closeScope();
 			}
-		}
 		*/
 
-		if (let b = node as AstNode.Stmt.Block)
-		{
+		case .Block(let b):
 			openNewScope("Block", b);
 			addStatementList(b.List);
 			closeScope();
-		}
 
-		if (let fun = node as AstNode.Stmt.FunctionDeclaration)
-		{
+		case .FunctionDecl(let fun):
 			openNewScope(scope $"Function ({fun.Name.Lexeme})", fun);
 
 			// Add parameters to scope
@@ -167,11 +171,9 @@ class Binder : Visitor
 
 			closeScope();
 
-			scope_tryDeclare(m_currentScope, fun.Name, new Entity.Function(m_currentScope, fun, getNamespaceParent(), fun.Name, getZenTypeFromNamedTypeExpr(fun.Type)), fun);
-		}
+			scope_tryDeclare(m_currentScope, fun.Name, new:m_alloc Entity.Function(m_currentScope, fun, getNamespaceParent(), fun.Name, getZenTypeFromNamedTypeExpr(fun.Type)), fun);
 
-		if (let str = node as AstNode.Stmt.StructDeclaration)
-		{
+		case .StructDecl(let str):
 			openNewScope(scope $"Struct ({str.Name.Lexeme})", str);
 
 			// Add fields to scope
@@ -183,17 +185,15 @@ class Binder : Visitor
 			closeScope();
 
 			let type = ZenType.Structure(str);
-			scope_tryDeclare(m_currentScope, str.Name, new Entity.TypeName(m_currentScope, str, getNamespaceParent(), str.Name, type), str);
+			scope_tryDeclare(m_currentScope, str.Name, new:m_alloc Entity.TypeName(m_currentScope, str, getNamespaceParent(), str.Name, type), str);
 
 			if (str.Fields.Count == 0)
 			{
 				// Sadge
 				reportError(str.Name, "C requires that a struct or union have at least one member");
 			}
-		}
 
-		if (let _enum = node as AstNode.Stmt.EnumDeclaration)
-		{
+		case .EnumDecl(let _enum):
 			openNewScope(scope $"Enum ({_enum.Name.Lexeme})", _enum);
 
 			// Add values to scope
@@ -205,29 +205,21 @@ class Binder : Visitor
 			closeScope();
 
 			let type = ZenType.Enum(_enum);
-			scope_tryDeclare(m_currentScope, _enum.Name, new Entity.TypeName(m_currentScope, _enum, getNamespaceParent(), _enum.Name, type), _enum);
-		}
+			scope_tryDeclare(m_currentScope, _enum.Name, new:m_alloc Entity.TypeName(m_currentScope, _enum, getNamespaceParent(), _enum.Name, type), _enum);
 
-		if (let enumVal = node as AstNode.Stmt.EnumFieldValue)
-		{
+		case .EnumField(let enumVal):
 			let type = ZenType.Basic(.FromKind(.UntypedInteger));
-			scope_tryDeclare(m_currentScope, enumVal.Name, new Entity.Constant(m_currentScope, .EnumField(enumVal), getNamespaceParent(), default, enumVal.Name, type), node);
-		}
+			scope_tryDeclare(m_currentScope, enumVal.Name, new:m_alloc Entity.Constant(m_currentScope, .EnumField(enumVal), getNamespaceParent(), null, enumVal.Name, type), node);
 
-		if (let vari = node as AstNode.Stmt.VariableDeclaration)
-		{
+		case .VarDecl(let vari):
 			let type = getZenTypeFromNamedTypeExpr(vari.Type);
-			scope_tryDeclare(m_currentScope, vari.Name, new Entity.Variable(m_currentScope, vari, getNamespaceParent(), vari.Name, type), vari);
-		}
+			scope_tryDeclare(m_currentScope, vari.Name, new:m_alloc Entity.Variable(m_currentScope, vari, getNamespaceParent(), vari.Name, type), vari);
 
-		if (let constant = node as AstNode.Stmt.ConstantDeclaration)
-		{
+		case .ConstDecl(let constant):
 			let type = getZenTypeFromNamedTypeExpr(constant.Type);
-			scope_tryDeclare(m_currentScope, constant.Name, new Entity.Constant(m_currentScope, .Normal(constant), getNamespaceParent(), default, constant.Name, type), constant);
-		}
+			scope_tryDeclare(m_currentScope, constant.Name, new:m_alloc Entity.Constant(m_currentScope, .Normal(constant), getNamespaceParent(), null, constant.Name, type), constant);
 
-		if (let _if = node as AstNode.Stmt.If)
-		{
+		case .If(let _if):
 			openNewScope("If Then", _if.ThenBranch);
 			addStatement(_if.ThenBranch, false);
 			closeScope();
@@ -238,34 +230,33 @@ class Binder : Visitor
 				addStatement(_else, false);
 				closeScope();
 			}
-		}
 
-		if (let _for = node as AstNode.Stmt.For)
-		{
+		case .For(let _for):
 			openNewScope("For", _for);
 			addStatement(_for.Initialization);
 			addStatement(_for.Body, false);
 			closeScope();
-		}
 
-		if (let _while = node as AstNode.Stmt.While)
-		{
+		case .While(let _while):
 			openNewScope("While", _while);
 			addStatement(_while.Body, false);
 			closeScope();
+
+		case .Return, .Expression, .EOF:
+			// Nothing gets declared by these.
 		}
 	}
 
 	private bool scope_tryDeclare(Scope _scope, Token name, Entity entity, AstNode.Stmt stmt)
 	{
-		if (_scope.EntityMap.ContainsKey(name.Lexeme))
+		if (_scope.EntityMap.ContainsKey(name.Symbol))
 		{
-			delete entity;
 			reportError(name, "Identifier has already been declared");
 			return false;
 		}
 
-		_scope.DeclareWithAstNode(entity, name.Lexeme, stmt);
+		_scope.DeclareWithAstNode(entity, name.Symbol, stmt);
+		m_entityCount++;
 		// entity.Scope = this;
 		return true;
 	}
@@ -278,7 +269,7 @@ class Binder : Visitor
 
 		for (let e in _scope.EntityMap)
 		{
-			Console.WriteLine(scope $"{pad}   - {e.value.GetType().GetName(.. scope .())} {e.key}: type({e.value.Type})");
+			Console.WriteLine(scope $"{pad}   - {e.value.GetType().GetName(.. scope .())} {StringInterner.Global[e.key]}: type({e.value.Type})");
 		}
 
 		for (let child in _scope.Children)
@@ -308,31 +299,19 @@ class Binder : Visitor
 			// I don't feel comfortable messing with the AST here.
 			type.StoredType = getZenTypeFromNamedTypeExpr(innerExpr);
 
-			// @HACK, we're assuming it can only be a literal
-			// This might always be true for static arrays, but dynamic arrays will need to support variables and stuff.
-
-			int getCount()
+			// Anything but a plain number (constants, arithmetic) can only be worked out once names are resolved,
+			// so the Checker folds those later, see Checker.resolveType().
+			int count = ArrayType.UNKNOWN_COUNT;
+			if (countExpr.GetKind() case .Literal(let lit) && lit.HasValue)
 			{
-				switch (countExpr.GetKind())
-				{
-				case .Literal(let lit):
-					return lit.Value.Get<int>();
-				case .Binary(let bin):
-					switch (bin.Op.Kind)
-					{
-					default:
-						reportError(bin.Op, "Unhandled binary operator");
-						return -1;
-					}
-				default:
-					reportError(countExpr, "Expression kind isn't handled by the compiler. This is my fault sowwy!");
-					return -1;
-				}
+				if (lit.Value.TryGet<int>(let literalCount))
+					count = literalCount;
 			}
 
 			return .Array(ArrayType {
 				Element = &type.StoredType,
-				Count = getCount()
+				Count = count,
+				CountExpr = countExpr
 			});
 		}
 	}
@@ -4,16 +4,34 @@ using System.Diagnostics;
 
 namespace Zen;
 
+/// Resolves and type checks the whole program in a single walk over the AST.
+/// Declarations get their types resolved the first time anything needs them (see resolveEntity()),
+/// so using something before the walk reaches its declaration is fine, and dependency cycles get reported instead of recursing forever.
 class Checker : Visitor
 {
 	private readonly List<AstNode.Stmt> m_ast;
 	private readonly Scope m_globalScope;
 	private readonly List<Entity.Function> m_functionStack = new .() ~ delete _;
+	private readonly TypeTable m_types;
 
-	public this(List<AstNode.Stmt> ast, Scope globalScope)
+	/// The index a field is being gotten from right now, the only place an element of a struct of arrays may show up.
+	private AstNode.Expression.Index m_soaFieldAccess = null;
+
+	/// The counting loops the walk is inside of, innermost last, see Checker_Bounds.bf.
+	private readonly List<LoopRange> m_loopRanges = new .() ~ delete _;
+	/// How many branches and loops deep the walk is. Code nested deeper than its loop doesn't run on every iteration.
+	private int m_branchDepth = 0;
+
+	private readonly List<AstNode.Expression.Run> m_runs = new .() ~ delete _;
+
+	/// Every '#run' in the program, in the order they were checked. See CompileTimeRunner.
+	public List<AstNode.Expression.Run> Runs => m_runs;
+
+	public this(List<AstNode.Stmt> ast, Scope globalScope, TypeTable types)
 	{
 		this.m_ast = ast;
 		this.m_globalScope = globalScope;
+		this.m_types = types;
 	}
 
 	public Result<void> Run()
@@ -31,26 +49,31 @@ class Checker : Visitor
 
 	private void checkStatement(AstNode.Stmt stmt, Scope _scope)
 	{
-		if (let block = stmt as AstNode.Stmt.Block)
+		switch (stmt.GetKind())
 		{
+		case .Block(let block):
 			checkStatementList(block.List, block.Scope ?? _scope);
-		}
 
-		if (let ns = stmt as AstNode.Stmt.NamespaceDeclaration)
-		{
+		case .NamespaceDecl(let ns):
 			checkStatementList(ns.Ast, ns.Scope);
-			// _scope = ns.Scope;
-		}
 
-		if (let fun = stmt as AstNode.Stmt.FunctionDeclaration)
-		{
-			let entity = fun.Scope.LookupName(fun.Name.Lexeme).Value as Entity.Function;
+		case .FunctionDecl(let fun):
+			let entity = _scope.LookupStmtAs<Entity.Function>(fun).Value;
+			resolveEntity(entity);
 
-			if (fun.Kind == .Extern)
+			for (let param in fun.Parameters)
 			{
-				return;
+				let paramEntity = fun.Scope.LookupStmtAs<Entity.Variable>(param).Value;
+				resolveEntity(paramEntity);
+
+				// C arrays turn into pointers as parameters, but a struct of arrays would get copied.
+				if (paramEntity.ResolvedType case .Array(let arr) && arr.SoA)
+					reportError(param.Name, "A struct of arrays can't be passed by value, pass a pointer to it instead");
 			}
 
+			if (fun.Kind == .Extern)
+				return;
+
 			m_functionStack.Add(entity);
 
 			checkStatementList(fun.Body.List, fun.Scope);
@@ -66,11 +89,18 @@ class Checker : Visitor
 			*/
 
 			m_functionStack.PopBack();
-		}
 
-		if (let _var = stmt as AstNode.Stmt.VariableDeclaration)
-		{
-			let entity = _scope.LookupName(_var.Name.Lexeme).Value as Entity.Variable;
+		case .StructDecl(let _struct):
+			resolveEntity(_scope.LookupStmtAs<Entity.TypeName>(_struct).Value);
+
+			for (let field in _struct.Fields)
+			{
+				checkStatement(field, _struct.Scope);
+			}
+
+		case .VarDecl(let _var):
+			let entity = _scope.LookupStmtAs<Entity.Variable>(_var).Value;
+			resolveEntity(entity);
 
 			if (_var.Initializer != null)
 			{
@@ -80,41 +110,32 @@ class Checker : Visitor
 					reportError(_var.Initializer, scope $"Cannot assign '{initType.GetName(.. scope .())}' to '{entity.ResolvedType.GetName(.. scope .())}'");
 				}
 			}
-		}
-
-		if (let _const = stmt as AstNode.Stmt.ConstantDeclaration)
-		{
-			let entity = _scope.LookupName(_const.Name.Lexeme).Value as Entity.Constant;
 
-			if (_const.Initializer != null)
-			{
-				let initType = checkExpr(_const.Initializer, _scope, null, entity.ResolvedType);
-				checkTypesComparable(_const.Operator.Value, entity.ResolvedType, initType);
-			}
-		}
+		case .ConstDecl(let _const):
+			// Checks (and folds) the initializer too, see resolveEntity().
+			resolveEntity(_scope.LookupStmtAs<Entity.Constant>(_const).Value);
 
-		if (let ret = stmt as AstNode.Stmt.Return)
-		{
+		case .Return(let ret):
 			if (ret.Value != null)
 			{
+				let currentFun = m_functionStack.Back;
 				let retType = checkExpr(ret.Value, _scope);
-				if (!ZenType.AreTypesIdenticalUntyped(m_functionStack.Back.Type, retType))
+				if (!ZenType.AreTypesIdenticalUntyped(currentFun.ResolvedType, retType))
 				{
-					reportError(ret.Token, scope $"Return type mismatch: expected '{m_functionStack.Back.Type.GetName(.. scope .())}', got '{retType.GetName(.. scope .())}'");
+					reportError(ret.Token, scope $"Return type mismatch: expected '{currentFun.ResolvedType.GetName(.. scope .())}', got '{retType.GetName(.. scope .())}'");
 				}
 			}
-		}
 
-		if (let _if = stmt as AstNode.Stmt.If)
-		{
+		case .If(let _if):
 			checkExpressionIsTruthy(_if.Condition, _scope);
+
+			m_branchDepth++;
 			checkStatement(_if.ThenBranch, _if.ThenBranch.Scope);
 			if (_if.ElseBranch case .Ok(let _else))
 				checkStatement(_else, _else.Scope);
-		}
+			m_branchDepth--;
 
-		if (let _for = stmt as AstNode.Stmt.For)
-		{
+		case .For(let _for):
 			if (_for.Initialization != null)
 				checkStatement(_for.Initialization, _for.Scope);
 
@@ -124,29 +145,279 @@ class Checker : Visitor
 			if (_for.Updation != null)
 				checkExpr(_for.Updation, _for.Scope);
 
+			m_branchDepth++;
+			_for.HoistedBoundsCount = AstNode.Stmt.For.NO_HOISTED_BOUNDS;
+			let range = getLoopRange(_for);
+			if (range case .Ok(let loopRange))
+				m_loopRanges.Add(loopRange);
+
 			checkStatement(_for.Body, _for.Scope);
-		}
 
-		if (let _while = stmt as AstNode.Stmt.While)
-		{
+			if (range case .Ok)
+				m_loopRanges.PopBack();
+			m_branchDepth--;
+
+		case .While(let _while):
 			checkExpressionIsTruthy(_while.Condition, _while.Scope);
+
+			m_branchDepth++;
 			checkStatement(_while.Body, _while.Scope);
+			m_branchDepth--;
+
+		case .Expression(let expr):
+			// Only ever outside of functions, the parser doesn't allow it in them.
+			if (let run = expr.InnerExpr as AstNode.Expression.Run)
+				run.IsStatement = true;
+
+			checkExpr(expr.InnerExpr, _scope);
+
+		case .EnumDecl(let _enum):
+			resolveEntity(_scope.LookupStmtAs<Entity.TypeName>(_enum).Value);
+
+		case .EnumField, .EOF:
+			// Enum values are numbered along with their enum.
 		}
+	}
 
-		if (let _struct = stmt as AstNode.Stmt.StructDeclaration)
+	/// Works out an entity's resolved type, at most once. Called by whatever needs the type first,
+	/// which is either the walk reaching the declaration or a use of it somewhere else.
+	private void resolveEntity(Entity entity)
+	{
+		switch (entity.State)
 		{
-			for (let field in _struct.Fields)
+		case .Resolved:
+			return;
+		case .Resolving:
+			// Only structs can get here for now, everything else has its type spelled out.
+			reportError(entity.Token, scope $"'{entity.Token.Lexeme}' depends on itself");
+			return;
+		case .Unresolved:
+		}
+
+		entity.State = .Resolving;
+
+		switch (entity.GetKind())
+		{
+		case .Variable(let _var):
+			_var.ResolvedType = resolveEntityType(_var.Type, _var.Scope);
+			if (_var.Decl.Layout == .StructOfArrays)
+				_var.ResolvedType = resolveSoAVariable(_var);
+		case .Constant(let _const):
+			switch (_const.Decl)
 			{
-				checkStatement(field, _struct.Scope);
+			case .Normal(let decl):
+				_const.ResolvedType = resolveEntityType(_const.Type, _const.Scope);
+				if (decl.Initializer != null)
+					resolveConstantValue(_const, decl);
+			case .EnumField(let field):
+				resolveEntity(_const.Scope.LookupStmtAs<Entity.TypeName>(field.Enum).Value);
+			case .Builtin:
 			}
+		case .Function(let fun):
+			fun.ResolvedType = resolveEntityType(fun.Type, fun.Scope);
+		case .TypeName(let typename):
+			if (let _struct = typename.Decl as AstNode.Stmt.StructDeclaration)
+				resolveStructFields(_struct);
+			else if (let _enum = typename.Decl as AstNode.Stmt.EnumDeclaration)
+				resolveEnumValues(_enum);
+		case .Builtin, .Namespace:
+		}
+
+		entity.State = .Resolved;
+	}
+
+	/// A call, or a call into a namespace ('ns::f()').
+	private static bool isCall(AstNode.Expression expr)
+	{
+		if (let qn = expr as AstNode.Expression.QualifiedName)
+			return isCall(qn.Right);
+		return expr is AstNode.Expression.Call;
+	}
+
+	/// Checks a constant's initializer and keeps its value if it folded, converted to the constant's type.
+	/// Done while resolving so a constant used before its declaration (or from another namespace) still folds.
+	private void resolveConstantValue(Entity.Constant _const, AstNode.Stmt.ConstantDeclaration decl)
+	{
+		// Doesn't fold until it ran, the constant gets its value then.
+		if (let run = decl.Initializer as AstNode.Expression.Run)
+			run.Constant = _const;
+
+		let initType = checkExpr(decl.Initializer, _const.Scope, null, _const.ResolvedType);
+		checkTypesComparable(decl.Operator.Value, _const.ResolvedType, initType);
+
+		if (decl.Initializer.Folded == null)
+			return;
+
+		var value = decl.Initializer.Folded.Value;
+		if (_const.ResolvedType.IsTypeNumeric())
+		{
+			if (ConstantValue.Cast(value, _const.ResolvedType) case .Ok(let converted))
+				value = converted;
 		}
+		_const.Value = value;
+	}
 
-		if (let expr = stmt as AstNode.Stmt.ExpressionStmt)
+	/// Numbers an enum's values the way C does, counting up from the last explicit one.
+	/// Values that don't fold (and the ones counting up from them) are left for C to work out.
+	private void resolveEnumValues(AstNode.Stmt.EnumDeclaration _enum)
+	{
+		int64? next = 0;
+		for (let field in _enum.Values)
 		{
-			checkExpr(expr.InnerExpr, _scope);
+			let fieldEntity = _enum.Scope.LookupStmtAs<Entity.Constant>(field).Value;
+
+			if (field.Value != null)
+			{
+				let valueType = checkExpr(field.Value, _enum.Scope);
+				if (valueType != .Invalid && !valueType.IsTypeInteger())
+					reportError(field.Value, "Enum values must be integers");
+
+				next = null;
+				if (field.Value.Folded != null)
+				{
+					if (field.Value.Folded.Value.AsInt() case .Ok(let value))
+						next = value;
+				}
+			}
+
+			if (next != null)
+			{
+				fieldEntity.Value = .Int(next.Value);
+				next = next.Value + 1;
+			}
+
+			// Already numbered, so using a value from inside its own enum doesn't count as a cycle.
+			fieldEntity.State = .Resolved;
+		}
+	}
+
+	/// 'soa' on a variable only changes the layout of that one array.
+	private ZenType resolveSoAVariable(Entity.Variable _var)
+	{
+		if (_var.ResolvedType case .Array(var arr) && *arr.Element case .Structure(let _struct) && _struct.Kind != .Extern)
+		{
+			arr.SoA = true;
+			return m_types.Intern(.Array(arr));
+		}
+
+		reportError(_var.Decl.Name, "Only fixed-size arrays of structs can be declared as 'soa'");
+		return _var.ResolvedType;
+	}
+
+	/// A struct can only hold another struct by value once that one is complete, so its struct fields get resolved first.
+	/// Running into a struct that's still being resolved means it (indirectly) contains itself.
+	private void resolveStructFields(AstNode.Stmt.StructDeclaration _struct)
+	{
+		for (let field in _struct.Fields)
+		{
+			let fieldEntity = _struct.Scope.LookupStmtAs<Entity.Variable>(field).Value;
+			resolveEntity(fieldEntity);
+
+			var valueType = fieldEntity.ResolvedType;
+			while (valueType case .Array(let arr))
+				valueType = *arr.Element;
+
+			if (valueType case .Structure(let fieldStruct))
+			{
+				if (fieldStruct.Kind == .Extern)
+					continue;
+
+				let fieldTypeName = fieldStruct.Scope.LookupStmtAs<Entity.TypeName>(fieldStruct).Value;
+				if (fieldTypeName.State == .Resolving)
+				{
+					reportError(field.Name, scope $"Struct '{fieldStruct.Name.Lexeme}' can't contain itself, use a pointer instead");
+					continue;
+				}
+
+				resolveEntity(fieldTypeName);
+			}
+		}
+	}
+
+	private ZenType resolveEntityType(ZenType entityType, Scope _scope)
+	{
+		// We can't do anything if it's a type invalid. This should NEVER be the case unless the Binder didn't do its job!
+		// But of course, better safe than sorry. That's what asserts are for.
+		Runtime.Assert(entityType != .Invalid);
+
+		// We'll create a copy of the entity type as that's the base we're working with (and also we don't want to modify the base type we have, we want to return a new value).
+		ZenType resolvedType = entityType;
+		resolveType(ref resolvedType, _scope);
+
+		// Every resolved type is the table's copy, so later checks can compare them without walking them.
+		return m_types.Intern(resolvedType);
+	}
+
+	/// Takes a type and swaps the "SimpleNamed" and "QualifiedNamed" for symbol types.
+	/// So for example, if there's a struct named "Foo", and the type is a kind ".SimpleNamed", it will swap it from SimpleNamed to the struct called that if it finds it.
+	/// This also works with pointers. Note that this manipulates a ZenType already in memory!
+	private void resolveType(ref ZenType unresolvedType, Scope _scope)
+	{
+		switch (unresolvedType)
+		{
+		case .Basic:
+			// Basic types are defined globally, so we don't need to do anything here.
+		case .SimpleNamed(let simpleName):
+			let lookup = lookupScopeForIdentifier(_scope, simpleName);
+			if (lookup case .Ok(let res))
+			{
+				unresolvedType = res.Type;
+				return;
+			}
+			unresolvedType = .Invalid;
+		case .QualifiedNamed(let qualifiedName):
+			let leftScope = lookupScopeForIdentifier(_scope, qualifiedName.Left);
+
+			if (leftScope case .Ok(let leftEntity))
+			{
+				if (let decl = leftEntity as IEntityDeclaration)
+				{
+					if (let iScope = decl.Decl as AstNode.Stmt.IScope)
+					{
+						Runtime.Assert(qualifiedName.Right is AstNode.Expression.Variable);
+						let _var = qualifiedName.Right as AstNode.Expression.Variable;
+						let lookup = lookupScopeForIdentifier(iScope.Scope, _var.Name);
+						if (lookup case .Ok(var res))
+						{
+							unresolvedType = res.Type;
+							return;
+						}
+					}
+				}
+			}
+
+			unresolvedType = .Invalid;
+		case .Pointer(var ptr):
+			// Here we're swapping the pointer of the element from whatever we had before to the new resolved type.
+			// So this could be a pointer again or an array or an actual resolved type (handled in cases .SimpleNamed and .QualifiedNamed.
+			resolveType(ref *ptr.Element, _scope);
+		case .Array(var arr):
+			resolveType(ref *arr.Element, _scope);
+
+			if (arr.Count == ArrayType.UNKNOWN_COUNT && arr.CountExpr != null)
+				arr.Count = foldArrayCount(arr.CountExpr, _scope);
+
+			// Every array of a 'soa' struct is a struct of arrays.
+			if (*arr.Element case .Structure(let _struct) && _struct.Layout == .StructOfArrays)
+				arr.SoA = true;
+
+			unresolvedType = .Array(arr);
+		default:
+			Runtime.FatalError(scope $"What are you?!!!");
 		}
 	}
 
+	private int foldArrayCount(AstNode.Expression countExpr, Scope _scope)
+	{
+		checkExpr(countExpr, _scope);
+
+		if (countExpr.Folded != null && countExpr.Folded.Value.AsInt() case .Ok(let count) && count >= 0)
+			return (int)count;
+
+		reportError(countExpr, "Array size must be a constant, non-negative integer");
+		return 0;
+	}
+
 	private void checkEntity(Scope _scope, StringView name, Entity entity)
 	{
 		if (let v = entity as Entity.Variable)
@@ -156,7 +427,92 @@ class Checker : Visitor
 		}
 	}
 
+	/// Checks an expression and folds it if its value is known at compile time, see fold().
 	private ZenType checkExpr(AstNode.Expression expr, Scope _scope, Scope callScope = null, ZenType? expectedTypeQ = null)
+	{
+		let type = checkExprKind(expr, _scope, callScope, expectedTypeQ);
+		if (type != .Invalid)
+			expr.Folded = fold(expr, type);
+		return type;
+	}
+
+	/// Works out an expression's value from its operands, which were checked (and folded) before it.
+	private ConstantValue? fold(AstNode.Expression expr, ZenType type)
+	{
+		mixin folded(Result<ConstantValue> result)
+		{
+			if (result case .Ok(let value))
+				return value;
+			return null;
+		}
+
+		switch (expr.GetKind())
+		{
+		case .Literal(let lit):
+			if (lit.HasValue)
+				folded!(ConstantValue.FromVariant(lit.Value));
+
+		case .Grouping(let group):
+			return group.Expression.Folded;
+
+		case .Binary(let bin):
+			if (bin.Left.Folded != null && bin.Right.Folded != null)
+			{
+				if (bin.Op.Kind == .ForwardSlash || bin.Op.Kind == .Modulus)
+				{
+					if (bin.Right.Folded.Value case .Int(let divisor) && divisor == 0)
+					{
+						reportError(bin.Op, "Division by zero");
+						return null;
+					}
+				}
+
+				folded!(wrapInteger(ConstantValue.Binary(bin.Op.Kind, bin.Left.Folded.Value, bin.Right.Folded.Value), type));
+			}
+
+		case .Logical(let log):
+			if (log.Left.Folded != null && log.Right.Folded != null)
+				folded!(ConstantValue.Binary(log.Op.Kind, log.Left.Folded.Value, log.Right.Folded.Value));
+
+		case .Unary(let un):
+			if (un.Right.Folded != null)
+				folded!(wrapInteger(ConstantValue.Unary(un.Operator.Kind, un.Right.Folded.Value), type));
+
+		case .Cast(let cast):
+			if (cast.Value.Folded != null)
+				folded!(ConstantValue.Cast(cast.Value.Folded.Value, type));
+
+		case .Variable(let variable):
+			if (let constant = variable.ResolvedEntity as Entity.Constant)
+				return constant.Value;
+
+		case .QualifiedName(let qn):
+			return qn.Right.Folded;
+
+		default:
+		}
+
+		return null;
+	}
+
+	/// C does integer math at the operands' type, or at 'int' for anything narrower, so the folded value has to wrap around where C's would.
+	private static Result<ConstantValue> wrapInteger(Result<ConstantValue> result, ZenType type)
+	{
+		if (!(result case .Ok(let value)) || !(value case .Int) || !(type case .Basic(let basic)))
+			return result;
+
+		switch (basic.Kind)
+		{
+		case .Int8, .Int16, .UInt8, .UInt16:
+			return ConstantValue.Cast(value, .Basic(.FromKind(.Int32)));
+		case .Int, .Int32, .Int64, .UInt, .UInt32, .UInt64:
+			return ConstantValue.Cast(value, type);
+		default:
+			return result;
+		}
+	}
+
+	private ZenType checkExprKind(AstNode.Expression expr, Scope _scope, Scope callScope = null, ZenType? expectedTypeQ = null)
 	{
 		switch (expr.GetKind())
 		{
@@ -191,8 +547,11 @@ class Checker : Visitor
 			let entity = lookupScopeForIdentifier(_scope, variable.Name);
 			if (entity case .Err)
 			{
+				variable.ResolvedEntity = null;
 				return .Invalid;
 			}
+			variable.ResolvedEntity = entity.Value;
+			resolveEntity(entity.Value);
 
 			if (entity.Value.GetKind() case .Variable(let _var))
 			{
@@ -215,8 +574,12 @@ class Checker : Visitor
 				return .Invalid;
 			}
 
+			call.Callee.ResolvedEntity = entity.Value;
+
 			if (let calleeFun = entity.Value as Entity.Function)
 			{
+				resolveEntity(calleeFun);
+
 				if (call.Arguments.Count > calleeFun.Decl.Parameters.Count)
 				{
 					reportError(call.Close, scope $"Too many arguments, expected {call.Arguments.Count - calleeFun.Decl.Parameters.Count} fewer.");
@@ -243,8 +606,18 @@ class Checker : Visitor
 
 				return calleeFun.ResolvedType;
 			}
-			else if (entity.Value is Entity.Builtin)
+			else if (let builtin = entity.Value as Entity.Builtin)
 			{
+				// sizeof takes a type, which isn't an expression the Checker can check.
+				if (builtin.Name != "sizeof")
+				{
+					for (let arg in call.Arguments)
+					{
+						let argType = checkExpr(arg, callScope ?? _scope);
+						if (@arg.Index == 0 && argType != .Invalid)
+							call.ResolvedArgumentType = argType;
+					}
+				}
 				return .Invalid;
 			}
 
@@ -259,7 +632,10 @@ class Checker : Visitor
 			return x;
 
 		case .Get(let get):
+			let outerFieldAccess = m_soaFieldAccess;
+			m_soaFieldAccess = get.Object as AstNode.Expression.Index;
 			let objType = checkExpr(get.Object, _scope);
+			m_soaFieldAccess = outerFieldAccess;
 
 			// Runtime.Assert(objType case .Structure, "You can only get on structs");
 
@@ -280,7 +656,7 @@ class Checker : Visitor
 				{
 					if (let _var = val as Entity.Variable)
 					{
-						// if (_var.ResolvedType != null)
+						resolveEntity(_var);
 						return _var.ResolvedType;
 					}
 					return val.Type;
@@ -314,7 +690,11 @@ class Checker : Visitor
 			//let op = log.Op;
 
 			let leftType = checkExpr(log.Left, _scope);
+
+			// Short circuits, so the right side might not run.
+			m_branchDepth++;
 			let rightType = checkExpr(log.Right, _scope);
+			m_branchDepth--;
 
 			if (!leftType.IsTypeBoolean())
 			{
@@ -335,7 +715,7 @@ class Checker : Visitor
 			switch (op.Kind)
 			{ 
 			case .Ampersand:
-				return ZenType.Pointer(PointerType(&un.StoredType));
+				return m_types.PointerTo(rightType);
 			case .Star:
 				if (!rightType.IsTypePointer())
 				{
@@ -367,7 +747,7 @@ class Checker : Visitor
 			break;
 
 		case .QualifiedName(let qn):
-			let leftScope = _scope.LookupName(qn.Left.Lexeme);
+			let leftScope = _scope.LookupName(qn.Left.Symbol);
 
 			if (leftScope case .Ok(let leftEntity))
 			{
@@ -412,8 +792,7 @@ class Checker : Visitor
 				return checkExpr(qualified, _scope);
 
 			case .Pointer(let innerType):
-				var a = checkExpr(innerType, _scope);
-				return ZenType.Pointer(PointerType(&a));
+				return m_types.PointerTo(checkExpr(innerType, _scope));
 
 			case .Array(let innerType, let countExpr):
 				return checkExpr(innerType, _scope);
@@ -437,15 +816,26 @@ class Checker : Visitor
 			let arrayType = checkExpr(index.Array, _scope);
 			let indexType = checkExpr(index.Index, _scope);
 
-			// @TODO - pelly, 11/3/25
-			// Check if we're trying to get a negative index, that obviously makes no sense...
-			// Also if we're indexing above the count, that's out of bounds
-
 			if (!indexType.IsTypeInteger())
 				reportError(index, "Array index must be an integer type");
 
+			index.IsSoA = false;
+			index.Bounds = .None;
 			if (arrayType case .Array(let arr))
+			{
+				index.Bounds = getBoundsCheck(index, arr);
+				index.BoundsCount = arr.Count;
+
+				if (arr.SoA)
+				{
+					// There's no whole element in memory to copy or point at, only its fields.
+					index.IsSoA = true;
+					if (index != m_soaFieldAccess)
+						reportError(index, "An element of a struct of arrays can only be used through its fields, like 'array[i].field'");
+				}
+
 				return *arr.Element;
+			}
 
 			if (arrayType case .Pointer(let ptr))
 				return *ptr.Element;
@@ -500,6 +890,18 @@ class Checker : Visitor
 		case .InlinedC:
 			// Do nothing
 			return ZenType.Invalid;
+
+		case .Run(let run):
+			run.Scope = _scope;
+			run.ResolvedType = checkExpr(run.Value, _scope, null, expectedTypeQ);
+			m_runs.Add(run);
+
+			if (!isCall(run.Value))
+				reportError(run.Value, "'#run' needs a function call, like '#run build_tables()'");
+			else if (!run.IsStatement && !run.ResolvedType.IsTypeNumeric() && !run.ResolvedType.IsTypeBoolean())
+				reportError(run.Token, "'#run' can only produce integers, floats and bools");
+
+			return run.ResolvedType;
 		}
 
 		Runtime.FatalError("Uh oh! How did you get here?");
@@ -507,6 +909,9 @@ class Checker : Visitor
 
 	private bool checkTypesComparable(ZenType x, ZenType y)
 	{
+		if (ZenType.AreTypesIdentical(x, y))
+			return true;
+
 		// @HACK
 		if (!ZenType.AreTypesIdenticalUntyped(x, y))
 		{
@@ -556,7 +961,7 @@ class Checker : Visitor
 
 	private Result<Entity> lookupScopeForIdentifier(Scope _scope, Token name)
 	{
-		let entity = _scope.LookupName(name.Lexeme);
+		let entity = _scope.LookupName(name.Symbol);
 		if (entity case .Err)
 		{
 			reportError(name, scope $"Undeclared identifier '{name.Lexeme}'");
@@ -569,7 +974,7 @@ class Checker : Visitor
 	/// Doesn't look up the scope chain if it can't find the identifier.
 	private Result<Entity> lookinScopeForIdentifier(Scope _scope, Token name)
 	{
-		let entity = _scope.LookForName(name.Lexeme);
+		let entity = _scope.LookForName(name.Symbol);
 		if (entity case .Err)
 		{
 			reportError(name, scope $"Undeclared identifier '{name.Lexeme}'");
@@ -0,0 +1,330 @@
+using System;
+using System.Collections;
+
+namespace Zen;
+
+/// Works out which array accesses need a bounds check (see BoundsCheck) as the Checker walks the function bodies.
+/// An index is known to be in bounds when it folded to a constant, or when it's the counter of a counting 'for' loop
+/// ('for (var int i = 0; i < 16; i += 1)') that doesn't run past the array. When the loop's end is only known at runtime,
+/// the accesses made on every iteration are covered by checking the end once, before the loop.
+extension Checker
+{
+	/// A counting loop's counter, which goes from Start up to (not including) End in steps of Step for the whole body.
+	private struct LoopRange
+	{
+		public AstNode.Stmt.For Loop;
+		public Entity.Variable Counter;
+		public int64 Start;
+		/// Exclusive, null when the end is only known at runtime.
+		public int64? End;
+		public int64 Step;
+		/// The m_branchDepth of the body, anything deeper might not run on every iteration.
+		public int Depth;
+		/// The end is a local nothing in the loop can change, and the body can't leave early.
+		public bool CanHoist;
+	}
+
+	private BoundsCheck getBoundsCheck(AstNode.Expression.Index index, ArrayType arr)
+	{
+		if (arr.Count == ArrayType.UNKNOWN_COUNT)
+			return .None;
+
+		if (foldedInt(index.Index) case .Ok(let constant))
+		{
+			if (constant < 0 || constant >= arr.Count)
+				reportError(index.Index, scope $"Index {constant} is out of bounds for an array of {arr.Count}");
+			return .None;
+		}
+
+		let counter = (index.Index as AstNode.Expression.Variable)?.ResolvedEntity;
+		if (counter == null)
+			return .Inline;
+
+		for (int i = m_loopRanges.Count - 1; i >= 0; i--)
+		{
+			let range = m_loopRanges[i];
+			if (range.Counter != counter)
+				continue;
+
+			if (range.End != null)
+			{
+				// A loop that never runs can't index anything.
+				let end = range.End.Value;
+				if (end <= range.Start || lastIndex(range.Start, end, range.Step) < arr.Count)
+					return .None;
+				return .Inline;
+			}
+
+			if (range.CanHoist && range.Depth == m_branchDepth)
+			{
+				let loop = range.Loop;
+				if (loop.HoistedBoundsCount == AstNode.Stmt.For.NO_HOISTED_BOUNDS || arr.Count < loop.HoistedBoundsCount)
+					loop.HoistedBoundsCount = arr.Count;
+				loop.HoistedBoundsStart = range.Start;
+				loop.HoistedBoundsStep = range.Step;
+				return .Hoisted;
+			}
+
+			return .Inline;
+		}
+
+		return .Inline;
+	}
+
+	/// The last index a counter going from start up to (not including) end in steps of step gets to, same as zen_bounds_check_loop() in zen.h.
+	private static int64 lastIndex(int64 start, int64 end, int64 step)
+	{
+		return start + (end - 1 - start) / step * step;
+	}
+
+	/// Recognizes 'for (var int i = start; i < end; i += step)' (or 'i <= end', 'i = i + step') with a constant start of at least 0,
+	/// a constant step above 0 and a body that never writes to 'i'. Called after the loop's header was checked.
+	/// A counter that's only assigned in the header ('for (i = 0; ...)') also has to be a local nothing else can get to, see isPrivateLocal().
+	private Result<LoopRange> getLoopRange(AstNode.Stmt.For _for)
+	{
+		Entity.Variable counter = null;
+		AstNode.Expression start = null;
+		if (let decl = _for.Initialization as AstNode.Stmt.VariableDeclaration)
+		{
+			if (_for.Scope.LookupStmtAs<Entity.Variable>(decl) case .Ok(let _var))
+				counter = _var;
+			start = decl.Initializer;
+		}
+		else if (let stmt = _for.Initialization as AstNode.Stmt.ExpressionStmt)
+		{
+			if (let assign = stmt.InnerExpr as AstNode.Expression.Assign)
+			{
+				if (assign.Op.Kind == .Equal)
+				{
+					counter = (assign.Assignee as AstNode.Expression.Variable)?.ResolvedEntity as Entity.Variable;
+					start = assign.Value;
+
+					// A global, or a local something kept a pointer to, could be changed by a call in the body.
+					if (counter != null && !isPrivateLocal(counter))
+						return .Err;
+				}
+			}
+		}
+
+		if (counter == null || start == null || !isWideInteger(counter.ResolvedType))
+			return .Err;
+
+		LoopRange range = .() { Loop = _for, Counter = counter, Depth = m_branchDepth };
+		range.Start = Try!(foldedInt(start));
+		if (range.Start < 0)
+			return .Err;
+
+		// Counts up...
+		let update = _for.Updation as AstNode.Expression.Assign;
+		if (update == null || !isCounter(update.Assignee, counter))
+			return .Err;
+
+		int64 step = 0;
+		if (update.Op.Kind == .PlusEqual)
+		{
+			step = Try!(foldedInt(update.Value));
+		}
+		else if (update.Op.Kind == .Equal)
+		{
+			let sum = update.Value as AstNode.Expression.Binary;
+			if (sum == null || sum.Op.Kind != .Plus || !isCounter(sum.Left, counter))
+				return .Err;
+			step = Try!(foldedInt(sum.Right));
+		}
+
+		if (step <= 0 || mayWrite(_for.Body, counter.Token.Symbol, false))
+			return .Err;
+		range.Step = step;
+
+		// ...up to the end.
+		let condition = _for.Condition as AstNode.Expression.Binary;
+		if (condition == null || !isCounter(condition.Left, counter))
+			return .Err;
+		if (condition.Op.Kind != .Less && condition.Op.Kind != .LessEqual)
+			return .Err;
+
+		if (foldedInt(condition.Right) case .Ok(let end))
+		{
+			range.End = (condition.Op.Kind == .LessEqual) ? end + 1 : end;
+			return range;
+		}
+
+		range.CanHoist = isLoopInvariant(condition.Right, _for) && !mayReturn(_for.Body);
+		return range;
+	}
+
+	/// Only a local (or parameter) that isn't written to in the loop, and whose address is never taken, can't change while it runs.
+	private bool isLoopInvariant(AstNode.Expression expr, AstNode.Stmt.For _for)
+	{
+		let _var = (expr as AstNode.Expression.Variable)?.ResolvedEntity as Entity.Variable;
+		if (_var == null || !isWideInteger(_var.ResolvedType) || !isPrivateLocal(_var))
+			return false;
+
+		return !mayWrite(_for.Body, _var.Token.Symbol, false);
+	}
+
+	/// Declared somewhere in the current function and its address is never taken, so a call can't change it behind our back.
+	private bool isPrivateLocal(Entity.Variable _var)
+	{
+		if (m_functionStack.IsEmpty)
+			return false;
+
+		let function = m_functionStack.Back.Decl;
+		var declaredIn = _var.Scope;
+		while (declaredIn != function.Scope)
+		{
+			if (declaredIn.Parent case .Ok(let parent))
+				declaredIn = parent;
+			else
+				return false;
+		}
+
+		return !mayWrite(function.Body, _var.Token.Symbol, true);
+	}
+
+	private static bool isCounter(AstNode.Expression expr, Entity.Variable counter)
+	{
+		return (expr as AstNode.Expression.Variable)?.ResolvedEntity == counter;
+	}
+
+	/// Narrower counters could wrap around before reaching the end.
+	private static bool isWideInteger(ZenType type)
+	{
+		if (type case .Basic(let basic))
+		{
+			switch (basic.Kind)
+			{
+			case .Int, .Int32, .Int64, .UInt, .UInt32, .UInt64: return true;
+			default:
+			}
+		}
+		return false;
+	}
+
+	private static Result<int64> foldedInt(AstNode.Expression expr)
+	{
+		if (expr.Folded == null)
+			return .Err;
+		return expr.Folded.Value.AsInt();
+	}
+
+	/// Whether anything named like this might get assigned (or, with addressOnly, have its address taken) in there.
+	/// Goes by name, so shadowing names only make it more careful. Inlined C could do anything.
+	private static bool mayWrite(AstNode.Stmt stmt, SymbolID name, bool addressOnly)
+	{
+		if (stmt == null)
+			return false;
+
+		switch (stmt.GetKind())
+		{
+		case .Block(let block):
+			for (let node in block.List)
+			{
+				if (mayWrite(node, name, addressOnly))
+					return true;
+			}
+			return false;
+		case .VarDecl(let _var):
+			return _var.Initializer != null && mayWriteExpr(_var.Initializer, name, addressOnly);
+		case .Return(let ret):
+			return ret.Value != null && mayWriteExpr(ret.Value, name, addressOnly);
+		case .If(let _if):
+			if (mayWriteExpr(_if.Condition, name, addressOnly) || mayWrite(_if.ThenBranch, name, addressOnly))
+				return true;
+			return _if.ElseBranch case .Ok(let _else) && mayWrite(_else, name, addressOnly);
+		case .For(let _for):
+			return mayWrite(_for.Initialization, name, addressOnly)
+				|| (_for.Condition != null && mayWriteExpr(_for.Condition, name, addressOnly))
+				|| (_for.Updation != null && mayWriteExpr(_for.Updation, name, addressOnly))
+				|| mayWrite(_for.Body, name, addressOnly);
+		case .While(let _while):
+			return mayWriteExpr(_while.Condition, name, addressOnly) || mayWrite(_while.Body, name, addressOnly);
+		case .Expression(let expr):
+			return mayWriteExpr(expr.InnerExpr, name, addressOnly);
+		default:
+			return false;
+		}
+	}
+
+	private static bool mayWriteExpr(AstNode.Expression expr, SymbolID name, bool addressOnly)
+	{
+		switch (expr.GetKind())
+		{
+		case .Assign(let assign):
+			if (!addressOnly && (assign.Assignee as AstNode.Expression.Variable)?.Name.Symbol == name)
+				return true;
+			return mayWriteExpr(assign.Assignee, name, addressOnly) || mayWriteExpr(assign.Value, name, addressOnly);
+		case .Unary(let un):
+			if (un.Operator.Kind == .Ampersand && (un.Right as AstNode.Expression.Variable)?.Name.Symbol == name)
+				return true;
+			return mayWriteExpr(un.Right, name, addressOnly);
+		case .InlinedC:
+			return true;
+		case .Call(let call):
+			for (let arg in call.Arguments)
+			{
+				if (mayWriteExpr(arg, name, addressOnly))
+					return true;
+			}
+			return false;
+		case .Binary(let bin):
+			return mayWriteExpr(bin.Left, name, addressOnly) || mayWriteExpr(bin.Right, name, addressOnly);
+		case .Logical(let log):
+			return mayWriteExpr(log.Left, name, addressOnly) || mayWriteExpr(log.Right, name, addressOnly);
+		case .Grouping(let group):
+			return mayWriteExpr(group.Expression, name, addressOnly);
+		case .Get(let get):
+			return mayWriteExpr(get.Object, name, addressOnly);
+		case .Set(let set):
+			return mayWriteExpr(set.Object, name, addressOnly) || mayWriteExpr(set.Value, name, addressOnly);
+		case .Index(let index):
+			return mayWriteExpr(index.Array, name, addressOnly) || mayWriteExpr(index.Index, name, addressOnly);
+		case .Cast(let cast):
+			return mayWriteExpr(cast.Value, name, addressOnly);
+		case .Run(let run):
+			return mayWriteExpr(run.Value, name, addressOnly);
+		case .QualifiedName(let qn):
+			return mayWriteExpr(qn.Right, name, addressOnly);
+		case .CompositeLiteral(let composite):
+			for (let element in composite.Elements)
+			{
+				if (mayWriteExpr(element, name, addressOnly))
+					return true;
+			}
+			return false;
+		case .Variable, .Literal, .This, .NamedType:
+			return false;
+		}
+	}
+
+	/// A return in the body could stop the loop before it gets to the end a hoisted check assumed.
+	private static bool mayReturn(AstNode.Stmt stmt)
+	{
+		if (stmt == null)
+			return false;
+
+		switch (stmt.GetKind())
+		{
+		case .Return:
+			return true;
+		case .Block(let block):
+			for (let node in block.List)
+			{
+				if (mayReturn(node))
+					return true;
+			}
+			return false;
+		case .If(let _if):
+			return mayReturn(_if.ThenBranch) || (_if.ElseBranch case .Ok(let _else) && mayReturn(_else));
+		case .For(let _for):
+			return mayReturn(_for.Body);
+		case .While(let _while):
+			return mayReturn(_while.Body);
+		case .Expression(let expr):
+			// Inlined C could return (or exit) on its own.
+			return expr.InnerExpr is AstNode.Expression.InlinedC;
+		default:
+			return false;
+		}
+	}
+}
@@ -0,0 +1,219 @@
+using System;
+using System.Globalization;
+
+namespace Zen;
+
+/// The value of an expression that's known at compile time, worked out by the Checker (see AstNode.Expression.Folded).
+/// Integers are folded as int64 and floats as double, whatever width they end up as in C.
+/// A float64 (or anything C would've widened to one) is kept apart, so it's written out without the 'f' and doesn't lose its precision.
+enum ConstantValue
+{
+	case Int(int64 value);
+	case Float(double value);
+	case Float64(double value);
+	case Bool(bool value);
+
+	public static Result<ConstantValue> FromVariant(Variant value)
+	{
+		if (value.TryGet<int>(let i))
+			return .Ok(.Int(i));
+		if (value.TryGet<float>(let f))
+			return .Ok(.Float(f));
+		if (value.TryGet<bool>(let b))
+			return .Ok(.Bool(b));
+
+		// Strings and chars are left to C.
+		return .Err;
+	}
+
+	public Result<int64> AsInt()
+	{
+		if (this case .Int(let i))
+			return .Ok(i);
+		return .Err;
+	}
+
+	private Result<double> asFloat()
+	{
+		switch (this)
+		{
+		case .Int(let i): return .Ok(i);
+		case .Float(let f): return .Ok(f);
+		case .Float64(let f): return .Ok(f);
+		case .Bool: return .Err;
+		}
+	}
+
+	/// Folds 'x op y'. Fails for mismatched operands and for anything C would've trapped on (dividing by zero, or the smallest int64 by -1).
+	/// Integers come out at 64 bits, Cast() wraps them to the width C does the math at.
+	public static Result<ConstantValue> Binary(TokenKind op, ConstantValue x, ConstantValue y)
+	{
+		if (x case .Bool(let a))
+		{
+			if (!(y case .Bool(let b)))
+				return .Err;
+
+			switch (op)
+			{
+			case .EqualEqual: return .Ok(.Bool(a == b));
+			case .BangEqual:  return .Ok(.Bool(a != b));
+			case .And:        return .Ok(.Bool(a && b));
+			case .Or:         return .Ok(.Bool(a || b));
+			default:          return .Err;
+			}
+		}
+
+		if (x case .Int(let a) && y case .Int(let b))
+		{
+			switch (op)
+			{
+			case .Plus:         return .Ok(.Int(a + b));
+			case .Minus:        return .Ok(.Int(a - b));
+			case .Star:         return .Ok(.Int(a * b));
+			case .ForwardSlash: return (b == 0 || (a == int64.MinValue && b == -1)) ? .Err : .Ok(.Int(a / b));
+			case .Modulus:      return (b == 0 || (a == int64.MinValue && b == -1)) ? .Err : .Ok(.Int(a % b));
+			case .Less:         return .Ok(.Bool(a < b));
+			case .LessEqual:    return .Ok(.Bool(a <= b));
+			case .Greater:      return .Ok(.Bool(a > b));
+			case .GreaterEqual: return .Ok(.Bool(a >= b));
+			case .EqualEqual:   return .Ok(.Bool(a == b));
+			case .BangEqual:    return .Ok(.Bool(a != b));
+			default:            return .Err;
+			}
+		}
+
+		// Mixed integers and floats go through double, like C's usual arithmetic conversions.
+		let a = Try!(x.asFloat());
+		let b = Try!(y.asFloat());
+		let wide = (x case .Float64) || (y case .Float64);
+		switch (op)
+		{
+		case .Plus:         return finite(a + b, wide);
+		case .Minus:        return finite(a - b, wide);
+		case .Star:         return finite(a * b, wide);
+		case .ForwardSlash: return (b == 0) ? .Err : finite(a / b, wide);
+		case .Less:         return .Ok(.Bool(a < b));
+		case .LessEqual:    return .Ok(.Bool(a <= b));
+		case .Greater:      return .Ok(.Bool(a > b));
+		case .GreaterEqual: return .Ok(.Bool(a >= b));
+		case .EqualEqual:   return .Ok(.Bool(a == b));
+		case .BangEqual:    return .Ok(.Bool(a != b));
+		default:            return .Err;
+		}
+	}
+
+	/// C has no literal for infinity or NaN, so those are left for it to compute.
+	private static Result<ConstantValue> finite(double value, bool wide)
+	{
+		if (value.IsNaN || value.IsInfinity)
+			return .Err;
+		if (wide)
+			return .Ok(.Float64(value));
+		return .Ok(.Float((float)value));
+	}
+
+	public static Result<ConstantValue> Unary(TokenKind op, ConstantValue x)
+	{
+		switch (op)
+		{
+		case .Minus:
+			if (x case .Int(let i))
+				return .Ok(.Int(-i));
+			if (x case .Float(let f))
+				return .Ok(.Float(-f));
+			if (x case .Float64(let f))
+				return .Ok(.Float64(-f));
+		case .Bang:
+			if (x case .Bool(let b))
+				return .Ok(.Bool(!b));
+		default:
+		}
+
+		return .Err;
+	}
+
+	/// Converts to a basic type the way a C cast would, integers wrap around to the target's width.
+	public static Result<ConstantValue> Cast(ConstantValue x, ZenType target)
+	{
+		if (!(target case .Basic(let basic)))
+			return .Err;
+
+		if (basic.Kind == .Float64)
+			return .Ok(.Float64(Try!(x.asFloat())));
+		if (basic.Flags.HasFlagInclusive(.Float))
+			return .Ok(.Float((float)Try!(x.asFloat())));
+
+		if (!basic.Flags.HasFlagInclusive(.Integer))
+			return .Err;
+
+		int64 value = 0;
+		switch (x)
+		{
+		case .Int(let i): value = i;
+		case .Float(let f): value = (int64)f;
+		case .Float64(let f): value = (int64)f;
+		case .Bool: return .Err;
+		}
+
+		switch (basic.Kind)
+		{
+		case .Int8:   value = (int8)value;
+		case .Int16:  value = (int16)value;
+		// 'int' and 'uint' are C's, which are 32 bits.
+		case .Int32, .Int:   value = (int32)value;
+		case .UInt8:  value = (uint8)value;
+		case .UInt16: value = (uint16)value;
+		case .UInt32, .UInt: value = (uint32)value;
+		case .UInt64:
+			// Wouldn't fit in an int64.
+			if (value < 0)
+				return .Err;
+		default:
+		}
+
+		return .Ok(.Int(value));
+	}
+
+	/// Spells the value as a C literal. Floats get the same 'f' suffix as float literals in the source, float64s go without one.
+	public void ToC(String outString)
+	{
+		switch (this)
+		{
+		case .Int(let i):
+			if (i < 0)
+				outString.Append(scope $"({i})");
+			else
+				i.ToString(outString);
+		case .Float(let f):
+			AppendFloat(f, outString, "f");
+		case .Float64(let f):
+			AppendFloat(f, outString, "");
+		case .Bool(let b):
+			outString.Append(b ? "true" : "false");
+		}
+	}
+
+	/// Spells a float as a C literal that reads back as the same value.
+	public static void AppendFloat(double value, String outStr, StringView suffix)
+	{
+		if (value.IsNaN)
+		{
+			outStr.Append("NAN");
+			return;
+		}
+		if (value.IsInfinity)
+		{
+			outStr.Append((value < 0) ? "(-INFINITY)" : "INFINITY");
+			return;
+		}
+
+		let number = value.ToString(.. scope .(), "R", CultureInfo.InvariantCulture);
+		if (!number.Contains('.') && !number.Contains('E') && !number.Contains('e'))
+			number.Append(".0");
+
+		if (value < 0)
+			outStr.Append(scope $"({number}{suffix})");
+		else
+			outStr.Append(scope $"{number}{suffix}");
+	}
+}
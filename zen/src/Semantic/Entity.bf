@@ -26,11 +26,21 @@ enum EntityKind
 /// An entity is a named "thing" in the language.
 abstract class Entity
 {
+	public enum ResolveState
+	{
+		Unresolved,
+		Resolving,
+		Resolved
+	}
+
 	public readonly Scope Scope;
 	public readonly Token Token;
 
 	public ZenType Type;
 
+	/// Where the Checker is at with working out this entity's resolved type.
+	public ResolveState State = .Unresolved;
+
 	public this(Scope _scope, Token token, ZenType type)
 	{
 		this.Scope = _scope;
@@ -50,16 +60,19 @@ abstract class Entity
 		}
 
 		public readonly ConstantDecl Decl;
-		public readonly Variant Value ~ _.Dispose();
 		public readonly Namespace NamespaceParent;
 
 		/// The type the variable is holding, not to be confused with Variable.Type
 		public ZenType ResolvedType;
 
-		public this(Scope _scope, ConstantDecl node, Namespace namespaceParent, Variant value, Token token, ZenType type) : base(_scope, token, type)
+		/// Known up front for builtins, folded from the initializer (or the enum's numbering) by the Checker otherwise.
+		/// Stays null when the initializer isn't a compile time constant.
+		public ConstantValue? Value;
+
+		public this(Scope _scope, ConstantDecl node, Namespace namespaceParent, ConstantValue? value, Token token, ZenType type) : base(_scope, token, type)
 		{
 			this.Decl = node;
-			this.Value = Value;
+			this.Value = value;
 			this.NamespaceParent = namespaceParent;
 		}
 
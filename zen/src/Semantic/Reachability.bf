@@ -0,0 +1,416 @@
+using System;
+using System.Collections;
+
+namespace Zen;
+
+/// Works out which declarations the program can actually reach, starting from 'main' and the hot reload hooks
+/// the runtime looks up by name. The Generator only emits live ones, so the parts of big '#load'ed files
+/// (std, the raylib bindings) a program doesn't use never get handed to a C compiler.
+/// Runs on the checked scope tree, so names are already resolved.
+class Reachability
+{
+	/// Looked up by the host (see main() in the generated code and TccRuntime).
+	public const String[?] ROOTS = .("main", "hot_update", "hot_reload");
+
+	private readonly Scope m_globalScope;
+	private readonly HashSet<Entity> m_live = new .() ~ delete _;
+	private readonly List<Entity> m_worklist = new .() ~ delete _;
+
+	/// Every namespace level entity by name, only built when inlined C needs it.
+	private Dictionary<SymbolID, List<Entity>> m_entitiesByName = null ~ DeleteDictionaryAndValues!(_);
+
+	public this(Scope globalScope)
+	{
+		this.m_globalScope = globalScope;
+	}
+
+	public bool IsLive(Entity entity) => m_live.Contains(entity);
+
+	public void Run()
+	{
+		for (let root in ROOTS)
+		{
+			let symbol = StringInterner.Global.Find(root);
+			if (symbol != StringInterner.INVALID && m_globalScope.LookForName(symbol) case .Ok(let entity))
+				markLive(entity);
+		}
+
+		// Globals run their initializers before main, so any that might do something have to stay.
+		addSideEffectRoots(m_globalScope);
+
+		while (!m_worklist.IsEmpty)
+		{
+			visitEntity(m_worklist.PopBack());
+		}
+	}
+
+	/// Prints every namespace level declaration that won't be generated.
+	public void PrintStripped()
+	{
+		int count = 0;
+		printStripped(m_globalScope, ref count);
+
+		Console.ForegroundColor = .DarkGray;
+		Console.WriteLine(scope $"Stripped {count} unreachable {(count == 1) ? "declaration" : "declarations"}");
+		Console.ResetColor();
+	}
+
+	private void printStripped(Scope _scope, ref int count)
+	{
+		for (let entity in _scope.EntityMap)
+		{
+			if (let ns = entity.value as Entity.Namespace)
+			{
+				printStripped(ns.Decl.Scope, ref count);
+				continue;
+			}
+
+			if (!isGenerated(entity.value) || IsLive(entity.value))
+				continue;
+
+			Console.ForegroundColor = .DarkGray;
+			Console.WriteLine(scope $"  stripped {entity.value.GetType().GetName(.. scope .())} '{StringInterner.Global[entity.key]}' ({_scope.Name})");
+			count++;
+		}
+	}
+
+	/// What the Generator would've emitted on its own.
+	private static bool isGenerated(Entity entity)
+	{
+		switch (entity.GetKind())
+		{
+		case .Function(let fun):
+			return fun.Decl.Kind != .Extern;
+		case .TypeName(let typename):
+			if (let _struct = typename.Decl as AstNode.Stmt.StructDeclaration)
+				return _struct.Kind != .Extern;
+			if (let _enum = typename.Decl as AstNode.Stmt.EnumDeclaration)
+				return _enum.Kind != .Extern;
+			return false;
+		case .Constant(let constant):
+			return !(constant.Decl case .Builtin);
+		case .Variable:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	private void addSideEffectRoots(Scope _scope)
+	{
+		for (let entity in _scope.EntityMap)
+		{
+			switch (entity.value.GetKind())
+			{
+			case .Namespace(let ns):
+				addSideEffectRoots(ns.Decl.Scope);
+			case .Variable(let _var):
+				if (_var.Decl.Initializer != null && hasSideEffects(_var.Decl.Initializer))
+					markLive(_var);
+			default:
+			}
+		}
+	}
+
+	private static bool hasSideEffects(AstNode.Expression expr)
+	{
+		switch (expr.GetKind())
+		{
+		case .Call, .Assign, .InlinedC:
+			return true;
+		case .Binary(let bin):
+			return hasSideEffects(bin.Left) || hasSideEffects(bin.Right);
+		case .Logical(let log):
+			return hasSideEffects(log.Left) || hasSideEffects(log.Right);
+		case .Unary(let un):
+			return hasSideEffects(un.Right);
+		case .Grouping(let group):
+			return hasSideEffects(group.Expression);
+		case .Cast(let cast):
+			return hasSideEffects(cast.Value);
+		case .CompositeLiteral(let composite):
+			for (let element in composite.Elements)
+			{
+				if (hasSideEffects(element))
+					return true;
+			}
+			return false;
+		default:
+			return false;
+		}
+	}
+
+	private void markLive(Entity entity)
+	{
+		if (entity != null && m_live.Add(entity))
+			m_worklist.Add(entity);
+	}
+
+	private void visitEntity(Entity entity)
+	{
+		switch (entity.GetKind())
+		{
+		case .Function(let fun):
+			markType(fun.ResolvedType);
+			for (let param in fun.Decl.Parameters)
+			{
+				markLive(fun.Decl.Scope.LookupStmtAs<Entity.Variable>(param).Value);
+			}
+
+			if (fun.Decl.Kind != .Extern)
+				walkStatementList(fun.Decl.Body.List, fun.Decl.Scope);
+
+		case .Variable(let _var):
+			markType(_var.ResolvedType);
+			if (_var.Decl.Initializer != null)
+				walkExpr(_var.Decl.Initializer, _var.Scope);
+
+		case .Constant(let constant):
+			switch (constant.Decl)
+			{
+			case .Normal(let decl):
+				markType(constant.ResolvedType);
+				if (decl.Initializer != null)
+					walkExpr(decl.Initializer, constant.Scope);
+			case .EnumField(let field):
+				// Enum values are emitted as part of their enum.
+				markLive(constant.Scope.LookupStmtAs<Entity.TypeName>(field.Enum).Value);
+			case .Builtin:
+			}
+
+		case .TypeName(let typename):
+			if (let _struct = typename.Decl as AstNode.Stmt.StructDeclaration)
+			{
+				for (let field in _struct.Fields)
+				{
+					markLive(_struct.Scope.LookupStmtAs<Entity.Variable>(field).Value);
+				}
+			}
+			else if (let _enum = typename.Decl as AstNode.Stmt.EnumDeclaration)
+			{
+				for (let value in _enum.Values)
+				{
+					if (value.Value != null)
+						walkExpr(value.Value, _enum.Scope);
+				}
+			}
+
+		case .Builtin, .Namespace:
+		}
+	}
+
+	private void markType(ZenType type)
+	{
+		switch (type)
+		{
+		case .Structure(let _struct):
+			markLive(_struct.Scope.LookupStmtAs<Entity.TypeName>(_struct).Value);
+		case .Enum(let _enum):
+			markLive(_enum.Scope.LookupStmtAs<Entity.TypeName>(_enum).Value);
+		case .Pointer(let ptr):
+			markType(*ptr.Element);
+		case .Array(let arr):
+			markType(*arr.Element);
+		default:
+		}
+	}
+
+	private void walkStatementList(List<AstNode.Stmt> list, Scope _scope)
+	{
+		for (let stmt in list)
+		{
+			walkStatement(stmt, _scope);
+		}
+	}
+
+	private void walkStatement(AstNode.Stmt stmt, Scope _scope)
+	{
+		if (stmt == null)
+			return;
+
+		switch (stmt.GetKind())
+		{
+		case .Block(let block):
+			walkStatementList(block.List, block.Scope ?? _scope);
+		case .VarDecl(let _var):
+			markLive(_scope.LookupStmtAs<Entity.Variable>(_var).Value);
+		case .ConstDecl(let _const):
+			markLive(_scope.LookupStmtAs<Entity.Constant>(_const).Value);
+		case .Return(let ret):
+			if (ret.Value != null)
+				walkExpr(ret.Value, _scope);
+		case .If(let _if):
+			// The Generator drops the branch a folded condition rules out, so whatever only it uses can go too.
+			bool? alwaysTrue = null;
+			if (_if.Condition.Folded != null && _if.Condition.Folded.Value case .Bool(let value))
+				alwaysTrue = value;
+			else
+				walkExpr(_if.Condition, _scope);
+
+			if (alwaysTrue != false)
+				walkStatement(_if.ThenBranch, _if.ThenBranch.Scope);
+			if (alwaysTrue != true && _if.ElseBranch case .Ok(let _else))
+				walkStatement(_else, _else.Scope);
+		case .For(let _for):
+			walkStatement(_for.Initialization, _for.Scope);
+			if (_for.Condition != null)
+				walkExpr(_for.Condition, _for.Scope);
+			if (_for.Updation != null)
+				walkExpr(_for.Updation, _for.Scope);
+			walkStatement(_for.Body, _for.Scope);
+		case .While(let _while):
+			walkExpr(_while.Condition, _while.Scope);
+			walkStatement(_while.Body, _while.Scope);
+		case .Expression(let expr):
+			walkExpr(expr.InnerExpr, _scope);
+		case .FunctionDecl, .StructDecl, .EnumDecl, .EnumField, .NamespaceDecl, .EOF:
+			// Declarations are reached through their entities.
+		}
+	}
+
+	private void walkExpr(AstNode.Expression expr, Scope _scope)
+	{
+		switch (expr.GetKind())
+		{
+		case .Variable(let variable):
+			markLive(variable.ResolvedEntity ?? lookup(_scope, variable.Name));
+		case .Call(let call):
+			markLive(call.Callee.ResolvedEntity ?? lookup(_scope, call.Callee.Name));
+			for (let arg in call.Arguments)
+			{
+				walkExpr(arg, _scope);
+			}
+		case .Binary(let bin):
+			walkExpr(bin.Left, _scope);
+			walkExpr(bin.Right, _scope);
+		case .Logical(let log):
+			walkExpr(log.Left, _scope);
+			walkExpr(log.Right, _scope);
+		case .Unary(let un):
+			walkExpr(un.Right, _scope);
+		case .Grouping(let group):
+			walkExpr(group.Expression, _scope);
+		case .Get(let get):
+			walkExpr(get.Object, _scope);
+		case .Set(let set):
+			walkExpr(set.Object, _scope);
+			walkExpr(set.Value, _scope);
+		case .Assign(let assign):
+			walkExpr(assign.Assignee, _scope);
+			walkExpr(assign.Value, _scope);
+		case .Index(let index):
+			walkExpr(index.Array, _scope);
+			walkExpr(index.Index, _scope);
+		case .Cast(let cast):
+			walkExpr(cast.TargetType, _scope);
+			walkExpr(cast.Value, _scope);
+		case .QualifiedName(let qn):
+			if (let decl = lookup(_scope, qn.Left) as IEntityDeclaration)
+			{
+				if (let iScope = decl.Decl as AstNode.Stmt.IScope)
+					walkExpr(qn.Right, iScope.Scope);
+			}
+		case .NamedType(let type):
+			switch (type.Kind)
+			{
+			case .Simple(let name):
+				if (let typename = lookup(_scope, name) as Entity.TypeName)
+					markLive(typename);
+			case .Qualified(let qualified):
+				walkExpr(qualified, _scope);
+			case .Pointer(let inner):
+				walkExpr(inner, _scope);
+			case .Array(let inner, let count):
+				walkExpr(inner, _scope);
+				walkExpr(count, _scope);
+			}
+		case .CompositeLiteral(let composite):
+			if (composite.ResolvedInferredType != null)
+				markType(composite.ResolvedInferredType.Value);
+			for (let element in composite.Elements)
+			{
+				walkExpr(element, _scope);
+			}
+		case .InlinedC(let inlined):
+			markInlinedC(inlined.Code);
+		case .Run:
+			// Ran while compiling, only its result makes it into the output (see CompileTimeRunner).
+		case .Literal, .This:
+		}
+	}
+
+	private Entity lookup(Scope _scope, Token name)
+	{
+		if (_scope.LookupName(name.Symbol) case .Ok(let entity))
+			return entity;
+		return null;
+	}
+
+	/// Inlined C can use any Zen declaration through its C name ('zen_game_LEVEL'), which we can't see through.
+	/// So every identifier in it keeps every declaration named like one of its '_' separated tails alive ('game_LEVEL', 'LEVEL').
+	private void markInlinedC(StringView code)
+	{
+		if (m_entitiesByName == null)
+		{
+			m_entitiesByName = new .();
+			indexEntities(m_globalScope);
+		}
+
+		int i = 0;
+		while (i < code.Length)
+		{
+			if (!code[i].IsLetter && code[i] != '_')
+			{
+				i++;
+				continue;
+			}
+
+			let start = i;
+			while (i < code.Length && (code[i].IsLetterOrDigit || code[i] == '_'))
+				i++;
+
+			let identifier = code.Substring(start, i - start);
+			markByName(identifier);
+			for (let j < identifier.Length)
+			{
+				if (identifier[j] == '_' && j + 1 < identifier.Length)
+					markByName(identifier.Substring(j + 1));
+			}
+		}
+	}
+
+	private void markByName(StringView name)
+	{
+		let symbol = StringInterner.Global.Find(name);
+		if (symbol == StringInterner.INVALID)
+			return;
+
+		if (m_entitiesByName.TryGetValue(symbol, let entities))
+		{
+			for (let entity in entities)
+			{
+				markLive(entity);
+			}
+		}
+	}
+
+	private void indexEntities(Scope _scope)
+	{
+		for (let entity in _scope.EntityMap)
+		{
+			if (let ns = entity.value as Entity.Namespace)
+			{
+				indexEntities(ns.Decl.Scope);
+				continue;
+			}
+
+			List<Entity> entities = null;
+			if (!m_entitiesByName.TryGetValue(entity.key, out entities))
+			{
+				entities = new .();
+				m_entitiesByName.Add(entity.key, entities);
+			}
+			entities.Add(entity.value);
+		}
+	}
+}
@@ -9,12 +9,13 @@ class Scope
 	public readonly Result<Scope> Parent = .Err;
 	public readonly Result<Entity.Namespace> NamespaceParent = .Err;
 
-	public readonly List<Scope> Children = new .() ~ DeleteContainerAndItems!(_);
+	/// Scopes and entities are allocated by the Binder and owned by it, these only reference them.
+	public readonly List<Scope> Children = new .() ~ delete _;
 
-	public readonly Dictionary<StringView, Entity> EntityMap = new .() ~ delete _;
+	public readonly Dictionary<SymbolID, Entity> EntityMap = new .() ~ delete _;
 	public readonly Dictionary<AstNode.Stmt, Entity> NodeEntityMap = new .() ~ delete _;
 
-	private readonly List<Entity> m_entities = new .() ~ DeleteContainerAndItems!(_);
+	private readonly List<Entity> m_entities = new .() ~ delete _;
 
 	public readonly String Name = new .() ~ delete _;
 
@@ -34,7 +35,7 @@ class Scope
 	}
 
 	/// Doesn't look up the scope chain if it can't find the identifier.
-	public Result<Entity> LookForName(StringView name)
+	public Result<Entity> LookForName(SymbolID name)
 	{
 		if (EntityMap.TryGetValue(name, let entity))
 			return entity;
@@ -42,31 +43,50 @@ class Scope
 		return .Err;
 	}
 
-	public Result<Entity> LookupName(StringView name)
+	public Result<Entity> LookupName(SymbolID name)
 	{
-		if (EntityMap.TryGetValue(name, let entity))
-			return entity;
-
-		// Look upward the scope chain
-		if (Parent case .Ok(let parent))
-			return parent.LookupName(name);
-
-		return .Err;
+		// Walked iteratively, this runs for every identifier use in every pass.
+		var current = this;
+		while (true)
+		{
+			if (current.EntityMap.TryGetValue(name, let entity))
+				return entity;
+
+			// Look upward the scope chain
+			if (current.Parent case .Ok(let parent))
+				current = parent;
+			else
+				return .Err;
+		}
 	}
 
-	public Result<T> LookupName<T>(StringView name) where T : Entity
+	public Result<T> LookupName<T>(SymbolID name) where T : Entity
 	{
-		if (EntityMap.TryGetValue(name, let entity))
+		var current = this;
+		while (true)
 		{
-			if (entity is T)
-				return entity as T;
+			if (current.EntityMap.TryGetValue(name, let entity))
+			{
+				if (entity is T)
+					return entity as T;
+			}
+
+			// Look upward the scope chain
+			if (current.Parent case .Ok(let parent))
+				current = parent;
+			else
+				return .Err;
 		}
+	}
 
-		// Look upward the scope chain
-		if (Parent case .Ok(let parent))
-			return parent.LookupName<T>(name);
+	/// Slow path for names that don't come from a token.
+	public Result<Entity> LookupName(StringView name)
+	{
+		let symbol = StringInterner.Global.Find(name);
+		if (symbol == StringInterner.INVALID)
+			return .Err;
 
-		return .Err;
+		return LookupName(symbol);
 	}
 
 	public Result<Entity> LookupStmt(AstNode.Stmt stmt)
@@ -101,10 +121,10 @@ class Scope
 		Debug.Assert(entity.Scope == this);
 
 		m_entities.Add(entity);
-		EntityMap.Add(name, entity);
+		EntityMap.Add(StringInterner.Global.Intern(name), entity);
 	}
 
-	public void DeclareWithAstNode(Entity entity, StringView name, AstNode.Stmt stmt)
+	public void DeclareWithAstNode(Entity entity, SymbolID name, AstNode.Stmt stmt)
 	{
 		Debug.Assert(entity.Scope == this);
 
@@ -0,0 +1,178 @@
+using System;
+using System.Collections;
+
+namespace Zen;
+
+/// Zero is the invalid type.
+typealias TypeID = uint32;
+
+/// Every distinct resolved type of a build, each one stored exactly once.
+/// Canonical types only point at other canonical types (a pointer's element is the element's entry in here),
+/// so two canonical types are the same type exactly when they're bitwise equal, see ZenType.AreTypesIdentical().
+/// Filled in by the (single threaded) Checker, codegen only reads it through Find() from its workers.
+class TypeTable
+{
+	public const TypeID INVALID = 0;
+
+	public class TypeInfo
+	{
+		public readonly TypeID ID;
+		/// Canonical, so its elements point into the table as well.
+		public ZenType Type;
+
+		/// How the type is spelled in the generated C, filled in by the Generator before it starts emitting code.
+		public String CName ~ delete _;
+
+		public this(TypeID id)
+		{
+			this.ID = id;
+		}
+	}
+
+	/// What makes a type distinct. Named types are told apart by their declaration, composite ones by their element's ID.
+	private struct TypeKey : IHashable
+	{
+		public int Kind;
+		public int Payload;
+		public int Count;
+
+		public this(int kind, int payload, int count = 0)
+		{
+			this.Kind = kind;
+			this.Payload = payload;
+			this.Count = count;
+		}
+
+		public int GetHashCode()
+		{
+			return ((Kind * 31) + Payload) * 31 + Count;
+		}
+
+		public static bool operator==(Self lhs, Self rhs)
+		{
+			return lhs.Kind == rhs.Kind && lhs.Payload == rhs.Payload && lhs.Count == rhs.Count;
+		}
+	}
+
+	private readonly List<TypeInfo> m_types = new .() ~ DeleteContainerAndItems!(_);
+	private readonly Dictionary<TypeKey, TypeInfo> m_lookup = new .() ~ delete _;
+
+	public int Count => m_types.Count;
+	public List<TypeInfo> Types => m_types;
+
+	public TypeInfo this[TypeID id] => m_types[id];
+
+	public this()
+	{
+		// Reserve INVALID.
+		let invalid = new TypeInfo(INVALID);
+		invalid.Type = .Invalid;
+		m_types.Add(invalid);
+		m_lookup.Add(.(0, 0), invalid);
+	}
+
+	/// Returns the canonical copy of a resolved type, adding it (and its elements) if it's new.
+	/// Unresolved names have no identity of their own, they come back as .Invalid.
+	public ZenType Intern(ZenType type)
+	{
+		return InternInfo(type).Type;
+	}
+
+	public TypeID GetID(ZenType type)
+	{
+		return InternInfo(type).ID;
+	}
+
+	public ZenType PointerTo(ZenType element)
+	{
+		return Intern(.Pointer(PointerType(&InternInfo(element).Type)));
+	}
+
+	public TypeInfo InternInfo(ZenType type)
+	{
+		if (getKey(type, true) case .Ok(let key))
+		{
+			if (m_lookup.TryGetValue(key, let existing))
+				return existing;
+
+			return add(key, type);
+		}
+
+		return m_types[INVALID];
+	}
+
+	/// Doesn't add anything, for readers that run after the table was filled.
+	public Result<TypeInfo> Find(ZenType type)
+	{
+		if (getKey(type, false) case .Ok(let key))
+		{
+			if (m_lookup.TryGetValue(key, let existing))
+				return existing;
+		}
+
+		return .Err;
+	}
+
+	private TypeInfo add(TypeKey key, ZenType type)
+	{
+		// Elements first, so the new type can point at their canonical copies.
+		ZenType canonical = type;
+		switch (type)
+		{
+		case .Basic(let basic):
+			canonical = .Basic(BasicType.BasicTypes[key.Payload]);
+		case .Pointer(let ptr):
+			canonical = .Pointer(PointerType(&InternInfo(*ptr.Element).Type));
+		case .Array(let arr):
+			canonical = .Array(ArrayType {
+				Element = &InternInfo(*arr.Element).Type,
+				Count = arr.Count,
+				SoA = arr.SoA
+			});
+		default:
+		}
+
+		let info = new TypeInfo((TypeID)m_types.Count);
+		info.Type = canonical;
+		m_types.Add(info);
+		m_lookup.Add(key, info);
+		return info;
+	}
+
+	/// Without intern, a composite type whose element isn't in the table has no key either.
+	private Result<TypeKey> getKey(ZenType type, bool intern)
+	{
+		mixin elementID(ZenType* element)
+		{
+			TypeID id = INVALID;
+			if (intern)
+				id = InternInfo(*element).ID;
+			else if (Find(*element) case .Ok(let info))
+				id = info.ID;
+			else
+				return .Err;
+			(int)id
+		}
+
+		switch (type)
+		{
+		case .Invalid:
+			return TypeKey(0, 0);
+		case .Basic(let basic):
+			return TypeKey(1, BasicType.IndexOf(basic));
+		case .Structure(let _struct):
+			return TypeKey(2, (int)Internal.UnsafeCastToPtr(_struct));
+		case .Enum(let _enum):
+			return TypeKey(3, (int)Internal.UnsafeCastToPtr(_enum));
+		case .Namespace(let _ns):
+			return TypeKey(4, (int)Internal.UnsafeCastToPtr(_ns));
+		case .Pointer(let ptr):
+			return TypeKey(5, elementID!(ptr.Element));
+		case .Array(let arr):
+			return TypeKey(arr.SoA ? 7 : 6, elementID!(arr.Element), arr.Count);
+		default:
+			// Unresolved names.
+			return .Err;
+		}
+	}
+}
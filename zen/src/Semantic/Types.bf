@@ -130,6 +130,18 @@ struct BasicType
 		return .Err;
 	}
 
+	/// Where the type sits in BasicTypes, types that share a kind (float and float32) are still told apart by their name.
+	public static int IndexOf(BasicType basic)
+	{
+		for (let i < BasicTypes.Count)
+		{
+			if (basic.Kind == BasicTypes[i].Kind && basic.Name == BasicTypes[i].Name)
+				return i;
+		}
+
+		Runtime.FatalError("This should never happen");
+	}
+
 	public static BasicType FromKind(BasicKind kind)
 	{
 		for (let type in BasicTypes)
@@ -156,8 +168,15 @@ struct PointerType
 
 struct ArrayType
 {
+	/// The count isn't known until the Checker folds CountExpr.
+	public const int UNKNOWN_COUNT = -1;
+
 	public ZenType* Element;
 	public int Count;
+	public AstNode.Expression CountExpr;
+
+	/// Laid out as a struct of arrays (one per field of the element struct) instead, see DataLayout.
+	public bool SoA;
 }
 
 public enum ZenType
@@ -277,25 +296,17 @@ public enum ZenType
 		case .Pointer(let ptr):
 			outName.Append(scope $"Pointer->{ptr.Element.GetName(.. scope .())}");
 		case .Array(let arr):
+			if (arr.SoA)
+				outName.Append("SoA ");
 			outName.Append(scope $"Array({arr.Element.GetName(.. scope .())})[{arr.Count}]");
 		}
 	}
 
-	/*
+	/// Both types have to come from the same TypeTable, then this is a tag and pointer (or kind) compare.
 	public static bool AreTypesIdentical(ZenType x, ZenType y)
 	{
-		if (x == y)
-			return true;
-
-		if (x case .Basic(let bx))
-		{
-			if (y case .Basic(let by))
-				return bx.Kind == by.Kind;
-		}
-
-		return false;
+		return x == y;
 	}
-	*/
 
 	// @HACK
 	// I don't know how I feel about this...
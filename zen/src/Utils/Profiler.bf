@@ -0,0 +1,187 @@
+using System;
+using System.IO;
+using System.Collections;
+using System.Diagnostics;
+using System.Threading;
+
+namespace Zen;
+
+/// Records timed zones of the compiler's work, written out in Chrome's trace_event format
+/// (open it in chrome://tracing or https://ui.perfetto.dev).
+/// Zones can be recorded from any thread. While disabled, Begin() hands out empty zones and nothing gets allocated.
+class Profiler
+{
+	public class Event
+	{
+		public readonly String Name = new .() ~ delete _;
+		public readonly String Category = new .() ~ delete _;
+		/// Usually the file or function the zone was about, shown with the zone's arguments.
+		public readonly String Detail = new .() ~ delete _;
+
+		/// In microseconds since the profiler was started.
+		public int64 Start;
+		public int64 Duration;
+		public int ThreadID;
+
+		public readonly List<(String name, int64 value)> Counts = new .() ~ {
+			for (let count in _)
+				delete count.name;
+			delete _;
+		};
+	}
+
+	/// Closes its zone when disposed, use it with 'using'.
+	public struct Zone : IDisposable
+	{
+		private Profiler m_profiler;
+		private Event m_event;
+
+		public this(Profiler profiler, Event event)
+		{
+			this.m_profiler = profiler;
+			this.m_event = event;
+		}
+
+		/// Attaches a number (tokens, nodes, bytes...) to the zone.
+		public void Count(StringView name, int64 value)
+		{
+			if (m_event != null)
+				m_event.Counts.Add((new .(name), value));
+		}
+
+		public void Dispose()
+		{
+			if (m_event != null)
+				m_profiler.end(m_event);
+		}
+	}
+
+	private readonly Monitor m_monitor = new .() ~ delete _;
+	private readonly List<Event> m_events = new .() ~ DeleteContainerAndItems!(_);
+	private readonly Stopwatch m_clock = new .()..Start() ~ delete _;
+
+	public bool Enabled = false;
+
+	public Zone Begin(StringView name, StringView category, StringView detail = default)
+	{
+		if (!Enabled)
+			return .(this, null);
+
+		let event = new Event();
+		event.Name.Set(name);
+		event.Category.Set(category);
+		event.Detail.Set(detail);
+		event.ThreadID = Thread.CurrentThread.Id;
+		event.Start = now();
+
+		return .(this, event);
+	}
+
+	/// Drops every recorded event.
+	public void Clear()
+	{
+		using (m_monitor.Enter())
+		{
+			m_events.ClearAndDeleteItems();
+		}
+	}
+
+	/// Summed duration of every zone with this name, all the per file "Tokenizer" zones of a build for instance.
+	public TimeSpan GetTotal(StringView name)
+	{
+		int64 total = 0;
+		using (m_monitor.Enter())
+		{
+			for (let event in m_events)
+			{
+				if (event.Name == name)
+					total += event.Duration;
+			}
+		}
+
+		// Microseconds to 100ns ticks.
+		return TimeSpan(total * 10);
+	}
+
+	public Result<void> WriteChromeTrace(StringView path)
+	{
+		let json = scope String();
+		json.Append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+		using (m_monitor.Enter())
+		{
+			for (let event in m_events)
+			{
+				if (@event.Index > 0)
+					json.Append(',');
+
+				json.Append("\n{\"name\":");
+				AppendJsonString(json, event.Name);
+				json.Append(",\"cat\":");
+				AppendJsonString(json, event.Category);
+				json.Append(scope $",\"ph\":\"X\",\"pid\":1,\"tid\":{event.ThreadID},\"ts\":{event.Start},\"dur\":{event.Duration},\"args\":\{");
+
+				bool first = true;
+				if (!event.Detail.IsEmpty)
+				{
+					json.Append("\"detail\":");
+					AppendJsonString(json, event.Detail);
+					first = false;
+				}
+
+				for (let count in event.Counts)
+				{
+					if (!first)
+						json.Append(',');
+					AppendJsonString(json, count.name);
+					json.Append(scope $":{count.value}");
+					first = false;
+				}
+
+				json.Append("}}");
+			}
+		}
+
+		json.Append("\n]}\n");
+
+		return File.WriteAllText(path, json);
+	}
+
+	private void end(Event event)
+	{
+		event.Duration = now() - event.Start;
+
+		using (m_monitor.Enter())
+		{
+			m_events.Add(event);
+		}
+	}
+
+	private int64 now()
+	{
+		// TimeSpan ticks are 100ns.
+		return m_clock.Elapsed.Ticks / 10;
+	}
+
+	public static void AppendJsonString(String json, StringView text)
+	{
+		json.Append('"');
+		for (let c in text)
+		{
+			switch (c)
+			{
+			case '"':  json.Append("\\\"");
+			case '\\': json.Append("\\\\");
+			case '\n': json.Append("\\n");
+			case '\r': json.Append("\\r");
+			case '\t': json.Append("\\t");
+			default:
+				if (c < ' ')
+					json.AppendF("\\u{0:X4}", (int)c);
+				else
+					json.Append(c);
+			}
+		}
+		json.Append('"');
+	}
+}
@@ -1,16 +1,62 @@
 using System;
+using System.IO;
+using System.Collections;
 
 namespace Zen;
 
+/// Builds up generated code in a list of fixed size chunks, so growing the output never copies what's already written.
+/// Small builders (a parameter list, a condition) never leave their first chunk, big ones (a whole file) get handed to
+/// a CFile as-is and streamed out chunk by chunk.
 public class StringCodeBuilder
 {
-	private String m_code = new .() ~ delete _;
+	private const int CHUNK_SIZE = 64 * 1024;
+
+	/// Indentation up to this depth is a single append of a slice of this string.
+	private const String TABS = "\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t";
+	private const String BANNER_SEPARATOR = "// --------------------------------------------------------------";
+
+	private readonly List<String> m_chunks = new .() ~ DeleteContainerAndItems!(_);
+	private int m_length = 0;
 	private int m_tabCount;
 	private int m_line = 0;
 
 	private bool m_inMacro = false;
 
-	public String Code => m_code;
+	/// All of the code as one string. Joins the chunks the first time it's needed, so prefer WriteTo() for big outputs.
+	public String Code
+	{
+		get
+		{
+			if (m_chunks.IsEmpty)
+				m_chunks.Add(new .());
+
+			if (m_chunks.Count > 1)
+			{
+				let joined = new String(m_length);
+				for (let chunk in m_chunks)
+				{
+					joined.Append(chunk);
+				}
+
+				m_chunks.ClearAndDeleteItems();
+				m_chunks.Add(joined);
+			}
+
+			return m_chunks[0];
+		}
+	}
+
+	public int Length => m_length;
+	public bool IsEmpty => m_length == 0;
+
+	public this()
+	{
+	}
+
+	public this(StringView text)
+	{
+		appendRaw(text);
+	}
 
 	public void IncreaseTab()
 	{
@@ -34,38 +80,42 @@ public class StringCodeBuilder
 
 	public void Append(String text)
 	{
-		m_code.Append(text);
+		appendRaw(text);
 	}
 
 	public void Append(StringView text)
 	{
-		m_code.Append(text);
+		appendRaw(text);
 	}
 
 	public void Append(char8 char)
 	{
-		m_code.Append(char);
+		currentChunk(1).Append(char);
+		m_length++;
 	}
 
 	public void AppendLine(String text)
 	{
-		let lines = text.Split('\n');
-		for (let line in lines)
-		{
-			AppendNewLine();
-			AppendTabs();
-			Append(line);
-		}
+		AppendLine(StringView(text));
 	}
 
 	public void AppendLine(StringView text)
 	{
-		let lines = text.Split('\n');
-		for (let line in lines)
+		var rest = text;
+		while (true)
 		{
 			AppendNewLine();
 			AppendTabs();
-			Append(line);
+
+			let newLine = rest.IndexOf('\n');
+			if (newLine == -1)
+			{
+				appendRaw(rest);
+				break;
+			}
+
+			appendRaw(rest.Substring(0, newLine));
+			rest = rest.Substring(newLine + 1);
 		}
 	}
 
@@ -76,21 +126,44 @@ public class StringCodeBuilder
 		Append(char);
 	}
 
+	/// Same as AppendLine(other.Code), but moves the other builder's chunks over instead of copying and re-splitting them.
+	/// Only lines that don't need re-indenting can be moved, otherwise this falls back to AppendLine(). The other builder is left empty.
+	public void AppendLine(StringCodeBuilder other)
+	{
+		if (m_tabCount > 0 || m_inMacro)
+		{
+			AppendLine(other.Code);
+			other.Clear();
+			return;
+		}
+
+		AppendNewLine();
+		for (let chunk in other.m_chunks)
+		{
+			m_chunks.Add(chunk);
+		}
+		m_length += other.m_length;
+		m_line += Math.Max(other.m_line - 1, 0);
+
+		other.m_chunks.Clear();
+		other.Clear();
+	}
+
 	public void AppendNewLine()
 	{
 		if (m_inMacro)
 		{
-			m_code.Append('\\');
+			Append('\\');
 		}
 
-		if (m_line > 0) m_code.Append('\n');
+		if (m_line > 0) Append('\n');
 		m_line++;
 	}
 
 	public void AppendLineIgnoreTabs(StringView text)
 	{
-		if (m_line > 0) m_code.Append('\n');
-		m_code.Append(text);
+		if (m_line > 0) Append('\n');
+		appendRaw(text);
 		m_line++;
 	}
 
@@ -102,32 +175,26 @@ public class StringCodeBuilder
 
 	public void AppendTabs()
 	{
-		for (let i < m_tabCount)
+		var count = m_tabCount;
+		while (count > 0)
 		{
-			m_code.Append('\t');
+			let n = Math.Min(count, TABS.Length);
+			appendRaw(StringView(TABS, 0, n));
+			count -= n;
 		}
 	}
 
 	public void AppendBanner(String text)
 	{
-		let separatorChar = '-';
-		// let separatorLength = text.Length;
-		let separatorLength = 62;
-
-		mixin appendSeparator()
-		{
-			AppendNewLine();
-			AppendTabs();
-			Append("// ");
-			for (let i < separatorLength)
-			{
-				Append(separatorChar);
-			}
-		}
+		AppendNewLine();
+		AppendTabs();
+		Append(BANNER_SEPARATOR);
 
-		appendSeparator!();
 		AppendLine(scope $"// {text}");
-		appendSeparator!();
+
+		AppendNewLine();
+		AppendTabs();
+		Append(BANNER_SEPARATOR);
 	}
 
 	public void AppendBannerAutogen()
@@ -137,7 +204,57 @@ public class StringCodeBuilder
 
 	public void Clear()
 	{
-		m_code.Clear();
+		m_chunks.ClearAndDeleteItems();
+		m_length = 0;
 		m_line = 0;
 	}
-}
\ No newline at end of file
+
+	/// FNV-1a over the chunks, same as BuildCache.Hash(Code) without joining them.
+	public uint64 Hash()
+	{
+		uint64 hash = BuildCache.HASH_SEED;
+		for (let chunk in m_chunks)
+		{
+			hash = BuildCache.Hash(chunk, hash);
+		}
+		return hash;
+	}
+
+	public Result<void> WriteTo(Stream stream)
+	{
+		for (let chunk in m_chunks)
+		{
+			if (stream.TryWrite(.((uint8*)chunk.Ptr, chunk.Length)) case .Err)
+				return .Err;
+		}
+		return .Ok;
+	}
+
+	private void appendRaw(StringView text)
+	{
+		if (text.IsEmpty)
+			return;
+
+		currentChunk(text.Length).Append(text);
+		m_length += text.Length;
+	}
+
+	/// The chunk to append to, starts a new one rather than growing the current one past CHUNK_SIZE.
+	/// The first chunk starts out small, most builders only ever hold a line or two.
+	private String currentChunk(int appendLength)
+	{
+		if (m_chunks.IsEmpty)
+		{
+			m_chunks.Add(new .());
+			return m_chunks.Back;
+		}
+
+		let back = m_chunks.Back;
+		if (back.Length + appendLength <= CHUNK_SIZE || back.IsEmpty)
+			return back;
+
+		let chunk = new String(Math.Max(appendLength, CHUNK_SIZE));
+		m_chunks.Add(chunk);
+		return chunk;
+	}
+}
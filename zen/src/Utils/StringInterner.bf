@@ -0,0 +1,69 @@
+using System;
+using System.Collections;
+using System.Threading;
+
+namespace Zen;
+
+/// Zero is never handed out, it means "no symbol".
+typealias SymbolID = uint32;
+
+/// Maps every distinct identifier to a small integer, so the semantic passes can compare and hash names as integers.
+/// Tokenizers on different threads intern into the same table, so every access takes the lock.
+/// Per-file caches like the one in the Tokenizer keep that to once per distinct name per file.
+class StringInterner
+{
+	public static readonly StringInterner Global = new .() ~ delete _;
+
+	public const SymbolID INVALID = 0;
+
+	private readonly Monitor m_monitor = new .() ~ delete _;
+
+	/// Owns the text, the map's keys point into these strings.
+	private readonly List<String> m_strings = new .() ~ DeleteContainerAndItems!(_);
+	private readonly Dictionary<StringView, SymbolID> m_ids = new .() ~ delete _;
+
+	public this()
+	{
+		// Reserve INVALID.
+		m_strings.Add(new .());
+	}
+
+	public SymbolID Intern(StringView text)
+	{
+		using (m_monitor.Enter())
+		{
+			if (m_ids.TryGetValue(text, let id))
+				return id;
+
+			let str = new String(text);
+			let newID = (SymbolID)m_strings.Count;
+			m_strings.Add(str);
+			m_ids.Add(str, newID);
+
+			return newID;
+		}
+	}
+
+	/// Like Intern(), but doesn't add anything. A name that was never interned can't be declared anywhere either.
+	public SymbolID Find(StringView text)
+	{
+		using (m_monitor.Enter())
+		{
+			if (m_ids.TryGetValue(text, let id))
+				return id;
+
+			return INVALID;
+		}
+	}
+
+	public StringView this[SymbolID id]
+	{
+		get
+		{
+			using (m_monitor.Enter())
+			{
+				return m_strings[id];
+			}
+		}
+	}
+}
@@ -0,0 +1,138 @@
+using System;
+using System.Collections;
+using System.Threading;
+
+namespace Zen;
+
+/// A fixed set of worker threads pulling jobs off a shared queue.
+/// Jobs are allowed to enqueue more jobs, and the thread calling WaitIdle() helps out until everything is done,
+/// so a pool with zero threads just runs everything serially on the caller.
+/// Idle threads block on the events without a timeout. They're auto-reset and wake a single thread per Set(),
+/// so a worker passes m_jobAdded on when it leaves jobs behind or when it shuts down.
+class WorkerPool
+{
+	public typealias Job = delegate void();
+
+	private readonly List<Thread> m_threads = new .() ~ delete _;
+	private readonly List<Job> m_jobs = new .() ~ DeleteContainerAndItems!(_);
+
+	private readonly Monitor m_monitor = new .() ~ delete _;
+	private readonly WaitEvent m_jobAdded = new .() ~ delete _;
+	private readonly WaitEvent m_jobDone = new .() ~ delete _;
+
+	private int m_activeJobs = 0;
+	private bool m_shuttingDown = false;
+
+	public int ThreadCount => m_threads.Count;
+
+	public this(int threadCount)
+	{
+		for (let i < threadCount)
+		{
+			let thread = new Thread(new => workerLoop);
+			thread.Start(false);
+			m_threads.Add(thread);
+		}
+	}
+
+	public ~this()
+	{
+		using (m_monitor.Enter())
+		{
+			m_shuttingDown = true;
+		}
+
+		m_jobAdded.Set();
+
+		for (let thread in m_threads)
+		{
+			thread.Join();
+			delete thread;
+		}
+	}
+
+	/// Queues a job, the pool takes ownership of the delegate.
+	public void Enqueue(Job job)
+	{
+		using (m_monitor.Enter())
+		{
+			m_jobs.Add(job);
+		}
+
+		m_jobAdded.Set();
+	}
+
+	/// Blocks until the queue is empty and no job is running anymore, running queued jobs on the calling thread in the meantime.
+	/// With nothing left to take it sleeps until a job finishes, then checks again.
+	public void WaitIdle()
+	{
+		while (true)
+		{
+			Job job = null;
+			using (m_monitor.Enter())
+			{
+				if (m_jobs.IsEmpty && m_activeJobs == 0)
+					return;
+
+				job = takeJob();
+			}
+
+			if (job != null)
+				runJob(job);
+			else
+				m_jobDone.WaitFor();
+		}
+	}
+
+	/// The monitor has to be held when calling this.
+	private Job takeJob()
+	{
+		if (m_jobs.IsEmpty)
+			return null;
+
+		m_activeJobs++;
+		return m_jobs.PopBack();
+	}
+
+	private void runJob(Job job)
+	{
+		job();
+		delete job;
+
+		using (m_monitor.Enter())
+		{
+			m_activeJobs--;
+		}
+
+		m_jobDone.Set();
+	}
+
+	private void workerLoop()
+	{
+		while (true)
+		{
+			Job job = null;
+			bool moreJobs = false;
+			using (m_monitor.Enter())
+			{
+				if (m_shuttingDown)
+				{
+					// Wakes the next thread, which does the same, until all of them are out.
+					m_jobAdded.Set();
+					return;
+				}
+
+				job = takeJob();
+				moreJobs = !m_jobs.IsEmpty;
+			}
+
+			if (moreJobs)
+				m_jobAdded.Set();
+
+			if (job != null)
+				runJob(job);
+			else
+				m_jobAdded.WaitFor();
+		}
+	}
+}
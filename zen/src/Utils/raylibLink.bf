@@ -1,4 +1,6 @@
+using System;
 using System.IO;
+using Zen;
 static
 {
 	// This was supposed to be at comptime, but Beef kept crashing
@@ -9,7 +11,7 @@ static
 	{
 		let code = scope CodeBuilder();
 
-		code.AppendLine("private static void addRaylibSymbols(libtcc.TCCCompiler compiler)");
+		code.AppendLine("public static void c_raylib_add_symbols(HostSymbols symbols)");
 		code.AppendLine("{");
 		code.IncreaseTab();
 		let functions = typeof(RaylibBeef.Raylib).GetMethods(.Static);
@@ -34,7 +36,7 @@ static
 			}
 
 			code.AppendLine(scope $"function {fun.ReturnType}({parameters.Code}) {fun.Name} = => RaylibBeef.Raylib.{fun.Name};");
-			code.AppendLine(scope $"compiler.AddSymbol(\"{fun.Name}\", {fun.Name});");
+			code.AppendLine(scope $"symbols.AddSymbol(\"{fun.Name}\", {fun.Name});");
 		}
 		code.DecreaseTab();
 		code.AppendLine("}");
@@ -43,10 +45,15 @@ static
 	}
 	*/
 
+	/// Where raylib.h (and the rest of raylib's headers) are.
+	public static void c_raylib_include_path(String outPath)
+	{
+		Path.Combine(outPath, Directory.GetCurrentDirectory(.. scope .()), "vendor", "include");
+	}
+
 	public static void c_raylib_add(libtcc.TCCCompiler compiler)
 	{
-		let includePath = @"D:\zen\vendor\include";
-		compiler.AddIncludePath(includePath);
+		compiler.AddIncludePath(c_raylib_include_path(.. scope .()));
 
 #if BF_PLATFORM_WINDOWS
 		compiler.AddLibrary("gdi32");
@@ -54,1222 +61,1223 @@ static
 		compiler.AddLibrary("opengl32");
 #endif
 
-		c_raylib_add_symbols(compiler);
+		HostSymbols.Get().AddTo(compiler);
 	}
 
-	public static void c_raylib_add_symbols(libtcc.TCCCompiler compiler)
+	/// Only called once per process, see HostSymbols.
+	public static void c_raylib_add_symbols(HostSymbols symbols)
 	{
 		function void(int32 _width, int32 _height, char8* _title) InitWindow = => RaylibBeef.Raylib.InitWindow;
-		compiler.AddSymbol("InitWindow", InitWindow);
+		symbols.AddSymbol("InitWindow", InitWindow);
 		function void() CloseWindow = => RaylibBeef.Raylib.CloseWindow;
-		compiler.AddSymbol("CloseWindow", CloseWindow);
+		symbols.AddSymbol("CloseWindow", CloseWindow);
 		function bool() WindowShouldClose = => RaylibBeef.Raylib.WindowShouldClose;
-		compiler.AddSymbol("WindowShouldClose", WindowShouldClose);
+		symbols.AddSymbol("WindowShouldClose", WindowShouldClose);
 		function bool() IsWindowReady = => RaylibBeef.Raylib.IsWindowReady;
-		compiler.AddSymbol("IsWindowReady", IsWindowReady);
+		symbols.AddSymbol("IsWindowReady", IsWindowReady);
 		function bool() IsWindowFullscreen = => RaylibBeef.Raylib.IsWindowFullscreen;
-		compiler.AddSymbol("IsWindowFullscreen", IsWindowFullscreen);
+		symbols.AddSymbol("IsWindowFullscreen", IsWindowFullscreen);
 		function bool() IsWindowHidden = => RaylibBeef.Raylib.IsWindowHidden;
-		compiler.AddSymbol("IsWindowHidden", IsWindowHidden);
+		symbols.AddSymbol("IsWindowHidden", IsWindowHidden);
 		function bool() IsWindowMinimized = => RaylibBeef.Raylib.IsWindowMinimized;
-		compiler.AddSymbol("IsWindowMinimized", IsWindowMinimized);
+		symbols.AddSymbol("IsWindowMinimized", IsWindowMinimized);
 		function bool() IsWindowMaximized = => RaylibBeef.Raylib.IsWindowMaximized;
-		compiler.AddSymbol("IsWindowMaximized", IsWindowMaximized);
+		symbols.AddSymbol("IsWindowMaximized", IsWindowMaximized);
 		function bool() IsWindowFocused = => RaylibBeef.Raylib.IsWindowFocused;
-		compiler.AddSymbol("IsWindowFocused", IsWindowFocused);
+		symbols.AddSymbol("IsWindowFocused", IsWindowFocused);
 		function bool() IsWindowResized = => RaylibBeef.Raylib.IsWindowResized;
-		compiler.AddSymbol("IsWindowResized", IsWindowResized);
+		symbols.AddSymbol("IsWindowResized", IsWindowResized);
 		function bool(int32 _flag) IsWindowState = => RaylibBeef.Raylib.IsWindowState;
-		compiler.AddSymbol("IsWindowState", IsWindowState);
+		symbols.AddSymbol("IsWindowState", IsWindowState);
 		function bool(RaylibBeef.ConfigFlags _flag) IsWindowState0 = => RaylibBeef.Raylib.IsWindowState;
-		compiler.AddSymbol("IsWindowState", IsWindowState0);
+		symbols.AddSymbol("IsWindowState", IsWindowState0);
 		function void(int32 _flags) SetWindowState = => RaylibBeef.Raylib.SetWindowState;
-		compiler.AddSymbol("SetWindowState", SetWindowState);
+		symbols.AddSymbol("SetWindowState", SetWindowState);
 		function void(RaylibBeef.ConfigFlags _flag) SetWindowState1 = => RaylibBeef.Raylib.SetWindowState;
-		compiler.AddSymbol("SetWindowState", SetWindowState1);
+		symbols.AddSymbol("SetWindowState", SetWindowState1);
 		function void(int32 _flags) ClearWindowState = => RaylibBeef.Raylib.ClearWindowState;
-		compiler.AddSymbol("ClearWindowState", ClearWindowState);
+		symbols.AddSymbol("ClearWindowState", ClearWindowState);
 		function void(RaylibBeef.ConfigFlags _flag) ClearWindowState0 = => RaylibBeef.Raylib.ClearWindowState;
-		compiler.AddSymbol("ClearWindowState", ClearWindowState0);
+		symbols.AddSymbol("ClearWindowState", ClearWindowState0);
 		function void() ToggleFullscreen = => RaylibBeef.Raylib.ToggleFullscreen;
-		compiler.AddSymbol("ToggleFullscreen", ToggleFullscreen);
+		symbols.AddSymbol("ToggleFullscreen", ToggleFullscreen);
 		function void() ToggleBorderlessWindowed = => RaylibBeef.Raylib.ToggleBorderlessWindowed;
-		compiler.AddSymbol("ToggleBorderlessWindowed", ToggleBorderlessWindowed);
+		symbols.AddSymbol("ToggleBorderlessWindowed", ToggleBorderlessWindowed);
 		function void() MaximizeWindow = => RaylibBeef.Raylib.MaximizeWindow;
-		compiler.AddSymbol("MaximizeWindow", MaximizeWindow);
+		symbols.AddSymbol("MaximizeWindow", MaximizeWindow);
 		function void() MinimizeWindow = => RaylibBeef.Raylib.MinimizeWindow;
-		compiler.AddSymbol("MinimizeWindow", MinimizeWindow);
+		symbols.AddSymbol("MinimizeWindow", MinimizeWindow);
 		function void() RestoreWindow = => RaylibBeef.Raylib.RestoreWindow;
-		compiler.AddSymbol("RestoreWindow", RestoreWindow);
+		symbols.AddSymbol("RestoreWindow", RestoreWindow);
 		function void(RaylibBeef.Image* _images, int32 _count) SetWindowIcons = => RaylibBeef.Raylib.SetWindowIcons;
-		compiler.AddSymbol("SetWindowIcons", SetWindowIcons);
+		symbols.AddSymbol("SetWindowIcons", SetWindowIcons);
 		function void(char8* _title) SetWindowTitle = => RaylibBeef.Raylib.SetWindowTitle;
-		compiler.AddSymbol("SetWindowTitle", SetWindowTitle);
+		symbols.AddSymbol("SetWindowTitle", SetWindowTitle);
 		function void(int32 _x, int32 _y) SetWindowPosition = => RaylibBeef.Raylib.SetWindowPosition;
-		compiler.AddSymbol("SetWindowPosition", SetWindowPosition);
+		symbols.AddSymbol("SetWindowPosition", SetWindowPosition);
 		function void(int32 _monitor) SetWindowMonitor = => RaylibBeef.Raylib.SetWindowMonitor;
-		compiler.AddSymbol("SetWindowMonitor", SetWindowMonitor);
+		symbols.AddSymbol("SetWindowMonitor", SetWindowMonitor);
 		function void(int32 _width, int32 _height) SetWindowMinSize = => RaylibBeef.Raylib.SetWindowMinSize;
-		compiler.AddSymbol("SetWindowMinSize", SetWindowMinSize);
+		symbols.AddSymbol("SetWindowMinSize", SetWindowMinSize);
 		function void(int32 _width, int32 _height) SetWindowMaxSize = => RaylibBeef.Raylib.SetWindowMaxSize;
-		compiler.AddSymbol("SetWindowMaxSize", SetWindowMaxSize);
+		symbols.AddSymbol("SetWindowMaxSize", SetWindowMaxSize);
 		function void(int32 _width, int32 _height) SetWindowSize = => RaylibBeef.Raylib.SetWindowSize;
-		compiler.AddSymbol("SetWindowSize", SetWindowSize);
+		symbols.AddSymbol("SetWindowSize", SetWindowSize);
 		function void(float _opacity) SetWindowOpacity = => RaylibBeef.Raylib.SetWindowOpacity;
-		compiler.AddSymbol("SetWindowOpacity", SetWindowOpacity);
+		symbols.AddSymbol("SetWindowOpacity", SetWindowOpacity);
 		function void() SetWindowFocused = => RaylibBeef.Raylib.SetWindowFocused;
-		compiler.AddSymbol("SetWindowFocused", SetWindowFocused);
+		symbols.AddSymbol("SetWindowFocused", SetWindowFocused);
 		function void*() GetWindowHandle = => RaylibBeef.Raylib.GetWindowHandle;
-		compiler.AddSymbol("GetWindowHandle", GetWindowHandle);
+		symbols.AddSymbol("GetWindowHandle", GetWindowHandle);
 		function int32() GetScreenWidth = => RaylibBeef.Raylib.GetScreenWidth;
-		compiler.AddSymbol("GetScreenWidth", GetScreenWidth);
+		symbols.AddSymbol("GetScreenWidth", GetScreenWidth);
 		function int32() GetScreenHeight = => RaylibBeef.Raylib.GetScreenHeight;
-		compiler.AddSymbol("GetScreenHeight", GetScreenHeight);
+		symbols.AddSymbol("GetScreenHeight", GetScreenHeight);
 		function int32() GetRenderWidth = => RaylibBeef.Raylib.GetRenderWidth;
-		compiler.AddSymbol("GetRenderWidth", GetRenderWidth);
+		symbols.AddSymbol("GetRenderWidth", GetRenderWidth);
 		function int32() GetRenderHeight = => RaylibBeef.Raylib.GetRenderHeight;
-		compiler.AddSymbol("GetRenderHeight", GetRenderHeight);
+		symbols.AddSymbol("GetRenderHeight", GetRenderHeight);
 		function int32() GetMonitorCount = => RaylibBeef.Raylib.GetMonitorCount;
-		compiler.AddSymbol("GetMonitorCount", GetMonitorCount);
+		symbols.AddSymbol("GetMonitorCount", GetMonitorCount);
 		function int32() GetCurrentMonitor = => RaylibBeef.Raylib.GetCurrentMonitor;
-		compiler.AddSymbol("GetCurrentMonitor", GetCurrentMonitor);
+		symbols.AddSymbol("GetCurrentMonitor", GetCurrentMonitor);
 		function RaylibBeef.Vector2(int32 _monitor) GetMonitorPosition = => RaylibBeef.Raylib.GetMonitorPosition;
-		compiler.AddSymbol("GetMonitorPosition", GetMonitorPosition);
+		symbols.AddSymbol("GetMonitorPosition", GetMonitorPosition);
 		function int32(int32 _monitor) GetMonitorWidth = => RaylibBeef.Raylib.GetMonitorWidth;
-		compiler.AddSymbol("GetMonitorWidth", GetMonitorWidth);
+		symbols.AddSymbol("GetMonitorWidth", GetMonitorWidth);
 		function int32(int32 _monitor) GetMonitorHeight = => RaylibBeef.Raylib.GetMonitorHeight;
-		compiler.AddSymbol("GetMonitorHeight", GetMonitorHeight);
+		symbols.AddSymbol("GetMonitorHeight", GetMonitorHeight);
 		function int32(int32 _monitor) GetMonitorPhysicalWidth = => RaylibBeef.Raylib.GetMonitorPhysicalWidth;
-		compiler.AddSymbol("GetMonitorPhysicalWidth", GetMonitorPhysicalWidth);
+		symbols.AddSymbol("GetMonitorPhysicalWidth", GetMonitorPhysicalWidth);
 		function int32(int32 _monitor) GetMonitorPhysicalHeight = => RaylibBeef.Raylib.GetMonitorPhysicalHeight;
-		compiler.AddSymbol("GetMonitorPhysicalHeight", GetMonitorPhysicalHeight);
+		symbols.AddSymbol("GetMonitorPhysicalHeight", GetMonitorPhysicalHeight);
 		function int32(int32 _monitor) GetMonitorRefreshRate = => RaylibBeef.Raylib.GetMonitorRefreshRate;
-		compiler.AddSymbol("GetMonitorRefreshRate", GetMonitorRefreshRate);
+		symbols.AddSymbol("GetMonitorRefreshRate", GetMonitorRefreshRate);
 		function RaylibBeef.Vector2() GetWindowPosition = => RaylibBeef.Raylib.GetWindowPosition;
-		compiler.AddSymbol("GetWindowPosition", GetWindowPosition);
+		symbols.AddSymbol("GetWindowPosition", GetWindowPosition);
 		function RaylibBeef.Vector2() GetWindowScaleDPI = => RaylibBeef.Raylib.GetWindowScaleDPI;
-		compiler.AddSymbol("GetWindowScaleDPI", GetWindowScaleDPI);
+		symbols.AddSymbol("GetWindowScaleDPI", GetWindowScaleDPI);
 		function char8*(int32 _monitor) GetMonitorName = => RaylibBeef.Raylib.GetMonitorName;
-		compiler.AddSymbol("GetMonitorName", GetMonitorName);
+		symbols.AddSymbol("GetMonitorName", GetMonitorName);
 		function void(char8* _text) SetClipboardText = => RaylibBeef.Raylib.SetClipboardText;
-		compiler.AddSymbol("SetClipboardText", SetClipboardText);
+		symbols.AddSymbol("SetClipboardText", SetClipboardText);
 		function char8*() GetClipboardText = => RaylibBeef.Raylib.GetClipboardText;
-		compiler.AddSymbol("GetClipboardText", GetClipboardText);
+		symbols.AddSymbol("GetClipboardText", GetClipboardText);
 		function RaylibBeef.Image() GetClipboardImage = => RaylibBeef.Raylib.GetClipboardImage;
-		compiler.AddSymbol("GetClipboardImage", GetClipboardImage);
+		symbols.AddSymbol("GetClipboardImage", GetClipboardImage);
 		function void() EnableEventWaiting = => RaylibBeef.Raylib.EnableEventWaiting;
-		compiler.AddSymbol("EnableEventWaiting", EnableEventWaiting);
+		symbols.AddSymbol("EnableEventWaiting", EnableEventWaiting);
 		function void() DisableEventWaiting = => RaylibBeef.Raylib.DisableEventWaiting;
-		compiler.AddSymbol("DisableEventWaiting", DisableEventWaiting);
+		symbols.AddSymbol("DisableEventWaiting", DisableEventWaiting);
 		function void() ShowCursor = => RaylibBeef.Raylib.ShowCursor;
-		compiler.AddSymbol("ShowCursor", ShowCursor);
+		symbols.AddSymbol("ShowCursor", ShowCursor);
 		function void() HideCursor = => RaylibBeef.Raylib.HideCursor;
-		compiler.AddSymbol("HideCursor", HideCursor);
+		symbols.AddSymbol("HideCursor", HideCursor);
 		function bool() IsCursorHidden = => RaylibBeef.Raylib.IsCursorHidden;
-		compiler.AddSymbol("IsCursorHidden", IsCursorHidden);
+		symbols.AddSymbol("IsCursorHidden", IsCursorHidden);
 		function void() EnableCursor = => RaylibBeef.Raylib.EnableCursor;
-		compiler.AddSymbol("EnableCursor", EnableCursor);
+		symbols.AddSymbol("EnableCursor", EnableCursor);
 		function void() DisableCursor = => RaylibBeef.Raylib.DisableCursor;
-		compiler.AddSymbol("DisableCursor", DisableCursor);
+		symbols.AddSymbol("DisableCursor", DisableCursor);
 		function bool() IsCursorOnScreen = => RaylibBeef.Raylib.IsCursorOnScreen;
-		compiler.AddSymbol("IsCursorOnScreen", IsCursorOnScreen);
+		symbols.AddSymbol("IsCursorOnScreen", IsCursorOnScreen);
 		function void() BeginDrawing = => RaylibBeef.Raylib.BeginDrawing;
-		compiler.AddSymbol("BeginDrawing", BeginDrawing);
+		symbols.AddSymbol("BeginDrawing", BeginDrawing);
 		function void() EndDrawing = => RaylibBeef.Raylib.EndDrawing;
-		compiler.AddSymbol("EndDrawing", EndDrawing);
+		symbols.AddSymbol("EndDrawing", EndDrawing);
 		function void() EndMode2D = => RaylibBeef.Raylib.EndMode2D;
-		compiler.AddSymbol("EndMode2D", EndMode2D);
+		symbols.AddSymbol("EndMode2D", EndMode2D);
 		function void() EndMode3D = => RaylibBeef.Raylib.EndMode3D;
-		compiler.AddSymbol("EndMode3D", EndMode3D);
+		symbols.AddSymbol("EndMode3D", EndMode3D);
 		function void() EndTextureMode = => RaylibBeef.Raylib.EndTextureMode;
-		compiler.AddSymbol("EndTextureMode", EndTextureMode);
+		symbols.AddSymbol("EndTextureMode", EndTextureMode);
 		function void() EndShaderMode = => RaylibBeef.Raylib.EndShaderMode;
-		compiler.AddSymbol("EndShaderMode", EndShaderMode);
+		symbols.AddSymbol("EndShaderMode", EndShaderMode);
 		function void(int32 _mode) BeginBlendMode = => RaylibBeef.Raylib.BeginBlendMode;
-		compiler.AddSymbol("BeginBlendMode", BeginBlendMode);
+		symbols.AddSymbol("BeginBlendMode", BeginBlendMode);
 		function void(RaylibBeef.BlendMode _mode) BeginBlendMode0 = => RaylibBeef.Raylib.BeginBlendMode;
-		compiler.AddSymbol("BeginBlendMode", BeginBlendMode0);
+		symbols.AddSymbol("BeginBlendMode", BeginBlendMode0);
 		function void() EndBlendMode = => RaylibBeef.Raylib.EndBlendMode;
-		compiler.AddSymbol("EndBlendMode", EndBlendMode);
+		symbols.AddSymbol("EndBlendMode", EndBlendMode);
 		function void(int32 _x, int32 _y, int32 _width, int32 _height) BeginScissorMode = => RaylibBeef.Raylib.BeginScissorMode;
-		compiler.AddSymbol("BeginScissorMode", BeginScissorMode);
+		symbols.AddSymbol("BeginScissorMode", BeginScissorMode);
 		function void() EndScissorMode = => RaylibBeef.Raylib.EndScissorMode;
-		compiler.AddSymbol("EndScissorMode", EndScissorMode);
+		symbols.AddSymbol("EndScissorMode", EndScissorMode);
 		function void() EndVrStereoMode = => RaylibBeef.Raylib.EndVrStereoMode;
-		compiler.AddSymbol("EndVrStereoMode", EndVrStereoMode);
+		symbols.AddSymbol("EndVrStereoMode", EndVrStereoMode);
 		function RaylibBeef.Shader(char8* _vsFileName, char8* _fsFileName) LoadShader = => RaylibBeef.Raylib.LoadShader;
-		compiler.AddSymbol("LoadShader", LoadShader);
+		symbols.AddSymbol("LoadShader", LoadShader);
 		function RaylibBeef.Shader(char8* _vsCode, char8* _fsCode) LoadShaderFromMemory = => RaylibBeef.Raylib.LoadShaderFromMemory;
-		compiler.AddSymbol("LoadShaderFromMemory", LoadShaderFromMemory);
+		symbols.AddSymbol("LoadShaderFromMemory", LoadShaderFromMemory);
 		function void(int32 _fps) SetTargetFPS = => RaylibBeef.Raylib.SetTargetFPS;
-		compiler.AddSymbol("SetTargetFPS", SetTargetFPS);
+		symbols.AddSymbol("SetTargetFPS", SetTargetFPS);
 		function float() GetFrameTime = => RaylibBeef.Raylib.GetFrameTime;
-		compiler.AddSymbol("GetFrameTime", GetFrameTime);
+		symbols.AddSymbol("GetFrameTime", GetFrameTime);
 		function double() GetTime = => RaylibBeef.Raylib.GetTime;
-		compiler.AddSymbol("GetTime", GetTime);
+		symbols.AddSymbol("GetTime", GetTime);
 		function int32() GetFPS = => RaylibBeef.Raylib.GetFPS;
-		compiler.AddSymbol("GetFPS", GetFPS);
+		symbols.AddSymbol("GetFPS", GetFPS);
 		function void() SwapScreenBuffer = => RaylibBeef.Raylib.SwapScreenBuffer;
-		compiler.AddSymbol("SwapScreenBuffer", SwapScreenBuffer);
+		symbols.AddSymbol("SwapScreenBuffer", SwapScreenBuffer);
 		function void() PollInputEvents = => RaylibBeef.Raylib.PollInputEvents;
-		compiler.AddSymbol("PollInputEvents", PollInputEvents);
+		symbols.AddSymbol("PollInputEvents", PollInputEvents);
 		function void(double _seconds) WaitTime = => RaylibBeef.Raylib.WaitTime;
-		compiler.AddSymbol("WaitTime", WaitTime);
+		symbols.AddSymbol("WaitTime", WaitTime);
 		function void(int32 _seed) SetRandomSeed = => RaylibBeef.Raylib.SetRandomSeed;
-		compiler.AddSymbol("SetRandomSeed", SetRandomSeed);
+		symbols.AddSymbol("SetRandomSeed", SetRandomSeed);
 		function int32(int32 _min, int32 _max) GetRandomValue = => RaylibBeef.Raylib.GetRandomValue;
-		compiler.AddSymbol("GetRandomValue", GetRandomValue);
+		symbols.AddSymbol("GetRandomValue", GetRandomValue);
 		function int32*(int32 _count, int32 _min, int32 _max) LoadRandomSequence = => RaylibBeef.Raylib.LoadRandomSequence;
-		compiler.AddSymbol("LoadRandomSequence", LoadRandomSequence);
+		symbols.AddSymbol("LoadRandomSequence", LoadRandomSequence);
 		function void(int32* _sequence) UnloadRandomSequence = => RaylibBeef.Raylib.UnloadRandomSequence;
-		compiler.AddSymbol("UnloadRandomSequence", UnloadRandomSequence);
+		symbols.AddSymbol("UnloadRandomSequence", UnloadRandomSequence);
 		function void(char8* _fileName) TakeScreenshot = => RaylibBeef.Raylib.TakeScreenshot;
-		compiler.AddSymbol("TakeScreenshot", TakeScreenshot);
+		symbols.AddSymbol("TakeScreenshot", TakeScreenshot);
 		function void(int32 _flags) SetConfigFlags = => RaylibBeef.Raylib.SetConfigFlags;
-		compiler.AddSymbol("SetConfigFlags", SetConfigFlags);
+		symbols.AddSymbol("SetConfigFlags", SetConfigFlags);
 		function void(RaylibBeef.ConfigFlags _flags) SetConfigFlags0 = => RaylibBeef.Raylib.SetConfigFlags;
-		compiler.AddSymbol("SetConfigFlags", SetConfigFlags0);
+		symbols.AddSymbol("SetConfigFlags", SetConfigFlags0);
 		function void(char8* _url) OpenURL = => RaylibBeef.Raylib.OpenURL;
-		compiler.AddSymbol("OpenURL", OpenURL);
+		symbols.AddSymbol("OpenURL", OpenURL);
 		function void(int32 _logLevel, char8* _text) TraceLog = => RaylibBeef.Raylib.TraceLog;
-		compiler.AddSymbol("TraceLog", TraceLog);
+		symbols.AddSymbol("TraceLog", TraceLog);
 		function void(int32 _logLevel) SetTraceLogLevel = => RaylibBeef.Raylib.SetTraceLogLevel;
-		compiler.AddSymbol("SetTraceLogLevel", SetTraceLogLevel);
+		symbols.AddSymbol("SetTraceLogLevel", SetTraceLogLevel);
 		function void(RaylibBeef.TraceLogLevel _logLevel) SetTraceLogLevel0 = => RaylibBeef.Raylib.SetTraceLogLevel;
-		compiler.AddSymbol("SetTraceLogLevel", SetTraceLogLevel0);
+		symbols.AddSymbol("SetTraceLogLevel", SetTraceLogLevel0);
 		function void*(int32 _size) MemAlloc = => RaylibBeef.Raylib.MemAlloc;
-		compiler.AddSymbol("MemAlloc", MemAlloc);
+		symbols.AddSymbol("MemAlloc", MemAlloc);
 		function void*(void* _ptr, int32 _size) MemRealloc = => RaylibBeef.Raylib.MemRealloc;
-		compiler.AddSymbol("MemRealloc", MemRealloc);
+		symbols.AddSymbol("MemRealloc", MemRealloc);
 		function void(void* _ptr) MemFree = => RaylibBeef.Raylib.MemFree;
-		compiler.AddSymbol("MemFree", MemFree);
+		symbols.AddSymbol("MemFree", MemFree);
 		function void(RaylibBeef.Raylib.TraceLogCallback _callback) SetTraceLogCallback = => RaylibBeef.Raylib.SetTraceLogCallback;
-		compiler.AddSymbol("SetTraceLogCallback", SetTraceLogCallback);
+		symbols.AddSymbol("SetTraceLogCallback", SetTraceLogCallback);
 		function void(RaylibBeef.Raylib.LoadFileDataCallback _callback) SetLoadFileDataCallback = => RaylibBeef.Raylib.SetLoadFileDataCallback;
-		compiler.AddSymbol("SetLoadFileDataCallback", SetLoadFileDataCallback);
+		symbols.AddSymbol("SetLoadFileDataCallback", SetLoadFileDataCallback);
 		function void(RaylibBeef.Raylib.SaveFileDataCallback _callback) SetSaveFileDataCallback = => RaylibBeef.Raylib.SetSaveFileDataCallback;
-		compiler.AddSymbol("SetSaveFileDataCallback", SetSaveFileDataCallback);
+		symbols.AddSymbol("SetSaveFileDataCallback", SetSaveFileDataCallback);
 		function void(RaylibBeef.Raylib.LoadFileTextCallback _callback) SetLoadFileTextCallback = => RaylibBeef.Raylib.SetLoadFileTextCallback;
-		compiler.AddSymbol("SetLoadFileTextCallback", SetLoadFileTextCallback);
+		symbols.AddSymbol("SetLoadFileTextCallback", SetLoadFileTextCallback);
 		function void(RaylibBeef.Raylib.SaveFileTextCallback _callback) SetSaveFileTextCallback = => RaylibBeef.Raylib.SetSaveFileTextCallback;
-		compiler.AddSymbol("SetSaveFileTextCallback", SetSaveFileTextCallback);
+		symbols.AddSymbol("SetSaveFileTextCallback", SetSaveFileTextCallback);
 		function char8*(char8* _fileName, int32* _dataSize) LoadFileData = => RaylibBeef.Raylib.LoadFileData;
-		compiler.AddSymbol("LoadFileData", LoadFileData);
+		symbols.AddSymbol("LoadFileData", LoadFileData);
 		function void(char8* _data) UnloadFileData = => RaylibBeef.Raylib.UnloadFileData;
-		compiler.AddSymbol("UnloadFileData", UnloadFileData);
+		symbols.AddSymbol("UnloadFileData", UnloadFileData);
 		function bool(char8* _fileName, void* _data, int32 _dataSize) SaveFileData = => RaylibBeef.Raylib.SaveFileData;
-		compiler.AddSymbol("SaveFileData", SaveFileData);
+		symbols.AddSymbol("SaveFileData", SaveFileData);
 		function bool(char8* _data, int32 _dataSize, char8* _fileName) ExportDataAsCode = => RaylibBeef.Raylib.ExportDataAsCode;
-		compiler.AddSymbol("ExportDataAsCode", ExportDataAsCode);
+		symbols.AddSymbol("ExportDataAsCode", ExportDataAsCode);
 		function char8*(char8* _fileName) LoadFileText = => RaylibBeef.Raylib.LoadFileText;
-		compiler.AddSymbol("LoadFileText", LoadFileText);
+		symbols.AddSymbol("LoadFileText", LoadFileText);
 		function void(char8* _text) UnloadFileText = => RaylibBeef.Raylib.UnloadFileText;
-		compiler.AddSymbol("UnloadFileText", UnloadFileText);
+		symbols.AddSymbol("UnloadFileText", UnloadFileText);
 		function bool(char8* _fileName, char8* _text) SaveFileText = => RaylibBeef.Raylib.SaveFileText;
-		compiler.AddSymbol("SaveFileText", SaveFileText);
+		symbols.AddSymbol("SaveFileText", SaveFileText);
 		function bool(char8* _fileName) FileExists = => RaylibBeef.Raylib.FileExists;
-		compiler.AddSymbol("FileExists", FileExists);
+		symbols.AddSymbol("FileExists", FileExists);
 		function bool(char8* _dirPath) DirectoryExists = => RaylibBeef.Raylib.DirectoryExists;
-		compiler.AddSymbol("DirectoryExists", DirectoryExists);
+		symbols.AddSymbol("DirectoryExists", DirectoryExists);
 		function bool(char8* _fileName, char8* _ext) IsFileExtension = => RaylibBeef.Raylib.IsFileExtension;
-		compiler.AddSymbol("IsFileExtension", IsFileExtension);
+		symbols.AddSymbol("IsFileExtension", IsFileExtension);
 		function int32(char8* _fileName) GetFileLength = => RaylibBeef.Raylib.GetFileLength;
-		compiler.AddSymbol("GetFileLength", GetFileLength);
+		symbols.AddSymbol("GetFileLength", GetFileLength);
 		function char8*(char8* _fileName) GetFileExtension = => RaylibBeef.Raylib.GetFileExtension;
-		compiler.AddSymbol("GetFileExtension", GetFileExtension);
+		symbols.AddSymbol("GetFileExtension", GetFileExtension);
 		function char8*(char8* _filePath) GetFileName = => RaylibBeef.Raylib.GetFileName;
-		compiler.AddSymbol("GetFileName", GetFileName);
+		symbols.AddSymbol("GetFileName", GetFileName);
 		function char8*(char8* _filePath) GetFileNameWithoutExt = => RaylibBeef.Raylib.GetFileNameWithoutExt;
-		compiler.AddSymbol("GetFileNameWithoutExt", GetFileNameWithoutExt);
+		symbols.AddSymbol("GetFileNameWithoutExt", GetFileNameWithoutExt);
 		function char8*(char8* _filePath) GetDirectoryPath = => RaylibBeef.Raylib.GetDirectoryPath;
-		compiler.AddSymbol("GetDirectoryPath", GetDirectoryPath);
+		symbols.AddSymbol("GetDirectoryPath", GetDirectoryPath);
 		function char8*(char8* _dirPath) GetPrevDirectoryPath = => RaylibBeef.Raylib.GetPrevDirectoryPath;
-		compiler.AddSymbol("GetPrevDirectoryPath", GetPrevDirectoryPath);
+		symbols.AddSymbol("GetPrevDirectoryPath", GetPrevDirectoryPath);
 		function char8*() GetWorkingDirectory = => RaylibBeef.Raylib.GetWorkingDirectory;
-		compiler.AddSymbol("GetWorkingDirectory", GetWorkingDirectory);
+		symbols.AddSymbol("GetWorkingDirectory", GetWorkingDirectory);
 		function char8*() GetApplicationDirectory = => RaylibBeef.Raylib.GetApplicationDirectory;
-		compiler.AddSymbol("GetApplicationDirectory", GetApplicationDirectory);
+		symbols.AddSymbol("GetApplicationDirectory", GetApplicationDirectory);
 		function int32(char8* _dirPath) MakeDirectory = => RaylibBeef.Raylib.MakeDirectory;
-		compiler.AddSymbol("MakeDirectory", MakeDirectory);
+		symbols.AddSymbol("MakeDirectory", MakeDirectory);
 		function bool(char8* _dir) ChangeDirectory = => RaylibBeef.Raylib.ChangeDirectory;
-		compiler.AddSymbol("ChangeDirectory", ChangeDirectory);
+		symbols.AddSymbol("ChangeDirectory", ChangeDirectory);
 		function bool(char8* _path) IsPathFile = => RaylibBeef.Raylib.IsPathFile;
-		compiler.AddSymbol("IsPathFile", IsPathFile);
+		symbols.AddSymbol("IsPathFile", IsPathFile);
 		function bool(char8* _fileName) IsFileNameValid = => RaylibBeef.Raylib.IsFileNameValid;
-		compiler.AddSymbol("IsFileNameValid", IsFileNameValid);
+		symbols.AddSymbol("IsFileNameValid", IsFileNameValid);
 		function RaylibBeef.FilePathList(char8* _dirPath) LoadDirectoryFiles = => RaylibBeef.Raylib.LoadDirectoryFiles;
-		compiler.AddSymbol("LoadDirectoryFiles", LoadDirectoryFiles);
+		symbols.AddSymbol("LoadDirectoryFiles", LoadDirectoryFiles);
 		function RaylibBeef.FilePathList(char8* _basePath, char8* _filter, bool _scanSubdirs) LoadDirectoryFilesEx = => RaylibBeef.Raylib.LoadDirectoryFilesEx;
-		compiler.AddSymbol("LoadDirectoryFilesEx", LoadDirectoryFilesEx);
+		symbols.AddSymbol("LoadDirectoryFilesEx", LoadDirectoryFilesEx);
 		function bool() IsFileDropped = => RaylibBeef.Raylib.IsFileDropped;
-		compiler.AddSymbol("IsFileDropped", IsFileDropped);
+		symbols.AddSymbol("IsFileDropped", IsFileDropped);
 		function RaylibBeef.FilePathList() LoadDroppedFiles = => RaylibBeef.Raylib.LoadDroppedFiles;
-		compiler.AddSymbol("LoadDroppedFiles", LoadDroppedFiles);
+		symbols.AddSymbol("LoadDroppedFiles", LoadDroppedFiles);
 		function int32(char8* _fileName) GetFileModTime = => RaylibBeef.Raylib.GetFileModTime;
-		compiler.AddSymbol("GetFileModTime", GetFileModTime);
+		symbols.AddSymbol("GetFileModTime", GetFileModTime);
 		function char8*(char8* _data, int32 _dataSize, int32* _compDataSize) CompressData = => RaylibBeef.Raylib.CompressData;
-		compiler.AddSymbol("CompressData", CompressData);
+		symbols.AddSymbol("CompressData", CompressData);
 		function char8*(char8* _compData, int32 _compDataSize, int32* _dataSize) DecompressData = => RaylibBeef.Raylib.DecompressData;
-		compiler.AddSymbol("DecompressData", DecompressData);
+		symbols.AddSymbol("DecompressData", DecompressData);
 		function char8*(char8* _data, int32 _dataSize, int32* _outputSize) EncodeDataBase64 = => RaylibBeef.Raylib.EncodeDataBase64;
-		compiler.AddSymbol("EncodeDataBase64", EncodeDataBase64);
+		symbols.AddSymbol("EncodeDataBase64", EncodeDataBase64);
 		function char8*(char8* _data, int32* _outputSize) DecodeDataBase64 = => RaylibBeef.Raylib.DecodeDataBase64;
-		compiler.AddSymbol("DecodeDataBase64", DecodeDataBase64);
+		symbols.AddSymbol("DecodeDataBase64", DecodeDataBase64);
 		function int32(char8* _data, int32 _dataSize) ComputeCRC32 = => RaylibBeef.Raylib.ComputeCRC32;
-		compiler.AddSymbol("ComputeCRC32", ComputeCRC32);
+		symbols.AddSymbol("ComputeCRC32", ComputeCRC32);
 		function int32*(char8* _data, int32 _dataSize) ComputeMD5 = => RaylibBeef.Raylib.ComputeMD5;
-		compiler.AddSymbol("ComputeMD5", ComputeMD5);
+		symbols.AddSymbol("ComputeMD5", ComputeMD5);
 		function int32*(char8* _data, int32 _dataSize) ComputeSHA1 = => RaylibBeef.Raylib.ComputeSHA1;
-		compiler.AddSymbol("ComputeSHA1", ComputeSHA1);
+		symbols.AddSymbol("ComputeSHA1", ComputeSHA1);
 		function RaylibBeef.AutomationEventList(char8* _fileName) LoadAutomationEventList = => RaylibBeef.Raylib.LoadAutomationEventList;
-		compiler.AddSymbol("LoadAutomationEventList", LoadAutomationEventList);
+		symbols.AddSymbol("LoadAutomationEventList", LoadAutomationEventList);
 		function void(RaylibBeef.AutomationEventList* _list) SetAutomationEventList = => RaylibBeef.Raylib.SetAutomationEventList;
-		compiler.AddSymbol("SetAutomationEventList", SetAutomationEventList);
+		symbols.AddSymbol("SetAutomationEventList", SetAutomationEventList);
 		function void(int32 _frame) SetAutomationEventBaseFrame = => RaylibBeef.Raylib.SetAutomationEventBaseFrame;
-		compiler.AddSymbol("SetAutomationEventBaseFrame", SetAutomationEventBaseFrame);
+		symbols.AddSymbol("SetAutomationEventBaseFrame", SetAutomationEventBaseFrame);
 		function void() StartAutomationEventRecording = => RaylibBeef.Raylib.StartAutomationEventRecording;
-		compiler.AddSymbol("StartAutomationEventRecording", StartAutomationEventRecording);
+		symbols.AddSymbol("StartAutomationEventRecording", StartAutomationEventRecording);
 		function void() StopAutomationEventRecording = => RaylibBeef.Raylib.StopAutomationEventRecording;
-		compiler.AddSymbol("StopAutomationEventRecording", StopAutomationEventRecording);
+		symbols.AddSymbol("StopAutomationEventRecording", StopAutomationEventRecording);
 		function bool(int32 _key) IsKeyPressed = => RaylibBeef.Raylib.IsKeyPressed;
-		compiler.AddSymbol("IsKeyPressed", IsKeyPressed);
+		symbols.AddSymbol("IsKeyPressed", IsKeyPressed);
 		function bool(RaylibBeef.KeyboardKey _key) IsKeyPressed0 = => RaylibBeef.Raylib.IsKeyPressed;
-		compiler.AddSymbol("IsKeyPressed", IsKeyPressed0);
+		symbols.AddSymbol("IsKeyPressed", IsKeyPressed0);
 		function bool(int32 _key) IsKeyPressedRepeat = => RaylibBeef.Raylib.IsKeyPressedRepeat;
-		compiler.AddSymbol("IsKeyPressedRepeat", IsKeyPressedRepeat);
+		symbols.AddSymbol("IsKeyPressedRepeat", IsKeyPressedRepeat);
 		function bool(RaylibBeef.KeyboardKey _key) IsKeyPressedRepeat0 = => RaylibBeef.Raylib.IsKeyPressedRepeat;
-		compiler.AddSymbol("IsKeyPressedRepeat", IsKeyPressedRepeat0);
+		symbols.AddSymbol("IsKeyPressedRepeat", IsKeyPressedRepeat0);
 		function bool(int32 _key) IsKeyDown = => RaylibBeef.Raylib.IsKeyDown;
-		compiler.AddSymbol("IsKeyDown", IsKeyDown);
+		symbols.AddSymbol("IsKeyDown", IsKeyDown);
 		function bool(RaylibBeef.KeyboardKey _key) IsKeyDown0 = => RaylibBeef.Raylib.IsKeyDown;
-		compiler.AddSymbol("IsKeyDown", IsKeyDown0);
+		symbols.AddSymbol("IsKeyDown", IsKeyDown0);
 		function bool(int32 _key) IsKeyReleased = => RaylibBeef.Raylib.IsKeyReleased;
-		compiler.AddSymbol("IsKeyReleased", IsKeyReleased);
+		symbols.AddSymbol("IsKeyReleased", IsKeyReleased);
 		function bool(RaylibBeef.KeyboardKey _key) IsKeyReleased0 = => RaylibBeef.Raylib.IsKeyReleased;
-		compiler.AddSymbol("IsKeyReleased", IsKeyReleased0);
+		symbols.AddSymbol("IsKeyReleased", IsKeyReleased0);
 		function bool(int32 _key) IsKeyUp = => RaylibBeef.Raylib.IsKeyUp;
-		compiler.AddSymbol("IsKeyUp", IsKeyUp);
+		symbols.AddSymbol("IsKeyUp", IsKeyUp);
 		function bool(RaylibBeef.KeyboardKey _key) IsKeyUp0 = => RaylibBeef.Raylib.IsKeyUp;
-		compiler.AddSymbol("IsKeyUp", IsKeyUp0);
+		symbols.AddSymbol("IsKeyUp", IsKeyUp0);
 		function int32() GetKeyPressed = => RaylibBeef.Raylib.GetKeyPressed;
-		compiler.AddSymbol("GetKeyPressed", GetKeyPressed);
+		symbols.AddSymbol("GetKeyPressed", GetKeyPressed);
 		function int32() GetCharPressed = => RaylibBeef.Raylib.GetCharPressed;
-		compiler.AddSymbol("GetCharPressed", GetCharPressed);
+		symbols.AddSymbol("GetCharPressed", GetCharPressed);
 		function void(int32 _key) SetExitKey = => RaylibBeef.Raylib.SetExitKey;
-		compiler.AddSymbol("SetExitKey", SetExitKey);
+		symbols.AddSymbol("SetExitKey", SetExitKey);
 		function void(RaylibBeef.KeyboardKey _key) SetExitKey0 = => RaylibBeef.Raylib.SetExitKey;
-		compiler.AddSymbol("SetExitKey", SetExitKey0);
+		symbols.AddSymbol("SetExitKey", SetExitKey0);
 		function bool(int32 _gamepad) IsGamepadAvailable = => RaylibBeef.Raylib.IsGamepadAvailable;
-		compiler.AddSymbol("IsGamepadAvailable", IsGamepadAvailable);
+		symbols.AddSymbol("IsGamepadAvailable", IsGamepadAvailable);
 		function char8*(int32 _gamepad) GetGamepadName = => RaylibBeef.Raylib.GetGamepadName;
-		compiler.AddSymbol("GetGamepadName", GetGamepadName);
+		symbols.AddSymbol("GetGamepadName", GetGamepadName);
 		function bool(int32 _gamepad, int32 _button) IsGamepadButtonPressed = => RaylibBeef.Raylib.IsGamepadButtonPressed;
-		compiler.AddSymbol("IsGamepadButtonPressed", IsGamepadButtonPressed);
+		symbols.AddSymbol("IsGamepadButtonPressed", IsGamepadButtonPressed);
 		function bool(int32 _gamepad, RaylibBeef.GamepadButton _button) IsGamepadButtonPressed0 = => RaylibBeef.Raylib.IsGamepadButtonPressed;
-		compiler.AddSymbol("IsGamepadButtonPressed", IsGamepadButtonPressed0);
+		symbols.AddSymbol("IsGamepadButtonPressed", IsGamepadButtonPressed0);
 		function bool(int32 _gamepad, int32 _button) IsGamepadButtonDown = => RaylibBeef.Raylib.IsGamepadButtonDown;
-		compiler.AddSymbol("IsGamepadButtonDown", IsGamepadButtonDown);
+		symbols.AddSymbol("IsGamepadButtonDown", IsGamepadButtonDown);
 		function bool(int32 _gamepad, RaylibBeef.GamepadButton _button) IsGamepadButtonDown0 = => RaylibBeef.Raylib.IsGamepadButtonDown;
-		compiler.AddSymbol("IsGamepadButtonDown", IsGamepadButtonDown0);
+		symbols.AddSymbol("IsGamepadButtonDown", IsGamepadButtonDown0);
 		function bool(int32 _gamepad, int32 _button) IsGamepadButtonReleased = => RaylibBeef.Raylib.IsGamepadButtonReleased;
-		compiler.AddSymbol("IsGamepadButtonReleased", IsGamepadButtonReleased);
+		symbols.AddSymbol("IsGamepadButtonReleased", IsGamepadButtonReleased);
 		function bool(int32 _gamepad, RaylibBeef.GamepadButton _button) IsGamepadButtonReleased0 = => RaylibBeef.Raylib.IsGamepadButtonReleased;
-		compiler.AddSymbol("IsGamepadButtonReleased", IsGamepadButtonReleased0);
+		symbols.AddSymbol("IsGamepadButtonReleased", IsGamepadButtonReleased0);
 		function bool(int32 _gamepad, int32 _button) IsGamepadButtonUp = => RaylibBeef.Raylib.IsGamepadButtonUp;
-		compiler.AddSymbol("IsGamepadButtonUp", IsGamepadButtonUp);
+		symbols.AddSymbol("IsGamepadButtonUp", IsGamepadButtonUp);
 		function bool(int32 _gamepad, RaylibBeef.GamepadButton _button) IsGamepadButtonUp0 = => RaylibBeef.Raylib.IsGamepadButtonUp;
-		compiler.AddSymbol("IsGamepadButtonUp", IsGamepadButtonUp0);
+		symbols.AddSymbol("IsGamepadButtonUp", IsGamepadButtonUp0);
 		function int32() GetGamepadButtonPressed = => RaylibBeef.Raylib.GetGamepadButtonPressed;
-		compiler.AddSymbol("GetGamepadButtonPressed", GetGamepadButtonPressed);
+		symbols.AddSymbol("GetGamepadButtonPressed", GetGamepadButtonPressed);
 		function int32(int32 _gamepad) GetGamepadAxisCount = => RaylibBeef.Raylib.GetGamepadAxisCount;
-		compiler.AddSymbol("GetGamepadAxisCount", GetGamepadAxisCount);
+		symbols.AddSymbol("GetGamepadAxisCount", GetGamepadAxisCount);
 		function float(int32 _gamepad, int32 _axis) GetGamepadAxisMovement = => RaylibBeef.Raylib.GetGamepadAxisMovement;
-		compiler.AddSymbol("GetGamepadAxisMovement", GetGamepadAxisMovement);
+		symbols.AddSymbol("GetGamepadAxisMovement", GetGamepadAxisMovement);
 		function float(int32 _gamepad, RaylibBeef.GamepadAxis _axis) GetGamepadAxisMovement0 = => RaylibBeef.Raylib.GetGamepadAxisMovement;
-		compiler.AddSymbol("GetGamepadAxisMovement", GetGamepadAxisMovement0);
+		symbols.AddSymbol("GetGamepadAxisMovement", GetGamepadAxisMovement0);
 		function int32(char8* _mappings) SetGamepadMappings = => RaylibBeef.Raylib.SetGamepadMappings;
-		compiler.AddSymbol("SetGamepadMappings", SetGamepadMappings);
+		symbols.AddSymbol("SetGamepadMappings", SetGamepadMappings);
 		function void(int32 _gamepad, float _leftMotor, float _rightMotor, float _duration) SetGamepadVibration = => RaylibBeef.Raylib.SetGamepadVibration;
-		compiler.AddSymbol("SetGamepadVibration", SetGamepadVibration);
+		symbols.AddSymbol("SetGamepadVibration", SetGamepadVibration);
 		function bool(int32 _button) IsMouseButtonPressed = => RaylibBeef.Raylib.IsMouseButtonPressed;
-		compiler.AddSymbol("IsMouseButtonPressed", IsMouseButtonPressed);
+		symbols.AddSymbol("IsMouseButtonPressed", IsMouseButtonPressed);
 		function bool(RaylibBeef.MouseButton _button) IsMouseButtonPressed0 = => RaylibBeef.Raylib.IsMouseButtonPressed;
-		compiler.AddSymbol("IsMouseButtonPressed", IsMouseButtonPressed0);
+		symbols.AddSymbol("IsMouseButtonPressed", IsMouseButtonPressed0);
 		function bool(int32 _button) IsMouseButtonDown = => RaylibBeef.Raylib.IsMouseButtonDown;
-		compiler.AddSymbol("IsMouseButtonDown", IsMouseButtonDown);
+		symbols.AddSymbol("IsMouseButtonDown", IsMouseButtonDown);
 		function bool(RaylibBeef.MouseButton _button) IsMouseButtonDown0 = => RaylibBeef.Raylib.IsMouseButtonDown;
-		compiler.AddSymbol("IsMouseButtonDown", IsMouseButtonDown0);
+		symbols.AddSymbol("IsMouseButtonDown", IsMouseButtonDown0);
 		function bool(int32 _button) IsMouseButtonReleased = => RaylibBeef.Raylib.IsMouseButtonReleased;
-		compiler.AddSymbol("IsMouseButtonReleased", IsMouseButtonReleased);
+		symbols.AddSymbol("IsMouseButtonReleased", IsMouseButtonReleased);
 		function bool(RaylibBeef.MouseButton _button) IsMouseButtonReleased0 = => RaylibBeef.Raylib.IsMouseButtonReleased;
-		compiler.AddSymbol("IsMouseButtonReleased", IsMouseButtonReleased0);
+		symbols.AddSymbol("IsMouseButtonReleased", IsMouseButtonReleased0);
 		function bool(int32 _button) IsMouseButtonUp = => RaylibBeef.Raylib.IsMouseButtonUp;
-		compiler.AddSymbol("IsMouseButtonUp", IsMouseButtonUp);
+		symbols.AddSymbol("IsMouseButtonUp", IsMouseButtonUp);
 		function bool(RaylibBeef.MouseButton _button) IsMouseButtonUp0 = => RaylibBeef.Raylib.IsMouseButtonUp;
-		compiler.AddSymbol("IsMouseButtonUp", IsMouseButtonUp0);
+		symbols.AddSymbol("IsMouseButtonUp", IsMouseButtonUp0);
 		function int32() GetMouseX = => RaylibBeef.Raylib.GetMouseX;
-		compiler.AddSymbol("GetMouseX", GetMouseX);
+		symbols.AddSymbol("GetMouseX", GetMouseX);
 		function int32() GetMouseY = => RaylibBeef.Raylib.GetMouseY;
-		compiler.AddSymbol("GetMouseY", GetMouseY);
+		symbols.AddSymbol("GetMouseY", GetMouseY);
 		function RaylibBeef.Vector2() GetMousePosition = => RaylibBeef.Raylib.GetMousePosition;
-		compiler.AddSymbol("GetMousePosition", GetMousePosition);
+		symbols.AddSymbol("GetMousePosition", GetMousePosition);
 		function RaylibBeef.Vector2() GetMouseDelta = => RaylibBeef.Raylib.GetMouseDelta;
-		compiler.AddSymbol("GetMouseDelta", GetMouseDelta);
+		symbols.AddSymbol("GetMouseDelta", GetMouseDelta);
 		function void(int32 _x, int32 _y) SetMousePosition = => RaylibBeef.Raylib.SetMousePosition;
-		compiler.AddSymbol("SetMousePosition", SetMousePosition);
+		symbols.AddSymbol("SetMousePosition", SetMousePosition);
 		function void(int32 _offsetX, int32 _offsetY) SetMouseOffset = => RaylibBeef.Raylib.SetMouseOffset;
-		compiler.AddSymbol("SetMouseOffset", SetMouseOffset);
+		symbols.AddSymbol("SetMouseOffset", SetMouseOffset);
 		function void(float _scaleX, float _scaleY) SetMouseScale = => RaylibBeef.Raylib.SetMouseScale;
-		compiler.AddSymbol("SetMouseScale", SetMouseScale);
+		symbols.AddSymbol("SetMouseScale", SetMouseScale);
 		function float() GetMouseWheelMove = => RaylibBeef.Raylib.GetMouseWheelMove;
-		compiler.AddSymbol("GetMouseWheelMove", GetMouseWheelMove);
+		symbols.AddSymbol("GetMouseWheelMove", GetMouseWheelMove);
 		function RaylibBeef.Vector2() GetMouseWheelMoveV = => RaylibBeef.Raylib.GetMouseWheelMoveV;
-		compiler.AddSymbol("GetMouseWheelMoveV", GetMouseWheelMoveV);
+		symbols.AddSymbol("GetMouseWheelMoveV", GetMouseWheelMoveV);
 		function void(int32 _cursor) SetMouseCursor = => RaylibBeef.Raylib.SetMouseCursor;
-		compiler.AddSymbol("SetMouseCursor", SetMouseCursor);
+		symbols.AddSymbol("SetMouseCursor", SetMouseCursor);
 		function void(RaylibBeef.MouseCursor _cursor) SetMouseCursor0 = => RaylibBeef.Raylib.SetMouseCursor;
-		compiler.AddSymbol("SetMouseCursor", SetMouseCursor0);
+		symbols.AddSymbol("SetMouseCursor", SetMouseCursor0);
 		function int32() GetTouchX = => RaylibBeef.Raylib.GetTouchX;
-		compiler.AddSymbol("GetTouchX", GetTouchX);
+		symbols.AddSymbol("GetTouchX", GetTouchX);
 		function int32() GetTouchY = => RaylibBeef.Raylib.GetTouchY;
-		compiler.AddSymbol("GetTouchY", GetTouchY);
+		symbols.AddSymbol("GetTouchY", GetTouchY);
 		function RaylibBeef.Vector2(int32 _index) GetTouchPosition = => RaylibBeef.Raylib.GetTouchPosition;
-		compiler.AddSymbol("GetTouchPosition", GetTouchPosition);
+		symbols.AddSymbol("GetTouchPosition", GetTouchPosition);
 		function int32(int32 _index) GetTouchPointId = => RaylibBeef.Raylib.GetTouchPointId;
-		compiler.AddSymbol("GetTouchPointId", GetTouchPointId);
+		symbols.AddSymbol("GetTouchPointId", GetTouchPointId);
 		function int32() GetTouchPointCount = => RaylibBeef.Raylib.GetTouchPointCount;
-		compiler.AddSymbol("GetTouchPointCount", GetTouchPointCount);
+		symbols.AddSymbol("GetTouchPointCount", GetTouchPointCount);
 		function void(int32 _flags) SetGesturesEnabled = => RaylibBeef.Raylib.SetGesturesEnabled;
-		compiler.AddSymbol("SetGesturesEnabled", SetGesturesEnabled);
+		symbols.AddSymbol("SetGesturesEnabled", SetGesturesEnabled);
 		function void(RaylibBeef.Gesture _flags) SetGesturesEnabled0 = => RaylibBeef.Raylib.SetGesturesEnabled;
-		compiler.AddSymbol("SetGesturesEnabled", SetGesturesEnabled0);
+		symbols.AddSymbol("SetGesturesEnabled", SetGesturesEnabled0);
 		function bool(int32 _gesture) IsGestureDetected = => RaylibBeef.Raylib.IsGestureDetected;
-		compiler.AddSymbol("IsGestureDetected", IsGestureDetected);
+		symbols.AddSymbol("IsGestureDetected", IsGestureDetected);
 		function bool(RaylibBeef.Gesture _gesture) IsGestureDetected0 = => RaylibBeef.Raylib.IsGestureDetected;
-		compiler.AddSymbol("IsGestureDetected", IsGestureDetected0);
+		symbols.AddSymbol("IsGestureDetected", IsGestureDetected0);
 		function int32() GetGestureDetected = => RaylibBeef.Raylib.GetGestureDetected;
-		compiler.AddSymbol("GetGestureDetected", GetGestureDetected);
+		symbols.AddSymbol("GetGestureDetected", GetGestureDetected);
 		function float() GetGestureHoldDuration = => RaylibBeef.Raylib.GetGestureHoldDuration;
-		compiler.AddSymbol("GetGestureHoldDuration", GetGestureHoldDuration);
+		symbols.AddSymbol("GetGestureHoldDuration", GetGestureHoldDuration);
 		function RaylibBeef.Vector2() GetGestureDragVector = => RaylibBeef.Raylib.GetGestureDragVector;
-		compiler.AddSymbol("GetGestureDragVector", GetGestureDragVector);
+		symbols.AddSymbol("GetGestureDragVector", GetGestureDragVector);
 		function float() GetGestureDragAngle = => RaylibBeef.Raylib.GetGestureDragAngle;
-		compiler.AddSymbol("GetGestureDragAngle", GetGestureDragAngle);
+		symbols.AddSymbol("GetGestureDragAngle", GetGestureDragAngle);
 		function RaylibBeef.Vector2() GetGesturePinchVector = => RaylibBeef.Raylib.GetGesturePinchVector;
-		compiler.AddSymbol("GetGesturePinchVector", GetGesturePinchVector);
+		symbols.AddSymbol("GetGesturePinchVector", GetGesturePinchVector);
 		function float() GetGesturePinchAngle = => RaylibBeef.Raylib.GetGesturePinchAngle;
-		compiler.AddSymbol("GetGesturePinchAngle", GetGesturePinchAngle);
+		symbols.AddSymbol("GetGesturePinchAngle", GetGesturePinchAngle);
 		function void(RaylibBeef.Camera3D* _camera, int32 _mode) UpdateCamera = => RaylibBeef.Raylib.UpdateCamera;
-		compiler.AddSymbol("UpdateCamera", UpdateCamera);
+		symbols.AddSymbol("UpdateCamera", UpdateCamera);
 		function void(RaylibBeef.Camera3D* _camera, RaylibBeef.CameraMode _mode) UpdateCamera0 = => RaylibBeef.Raylib.UpdateCamera;
-		compiler.AddSymbol("UpdateCamera", UpdateCamera0);
+		symbols.AddSymbol("UpdateCamera", UpdateCamera0);
 		function RaylibBeef.Texture() GetShapesTexture = => RaylibBeef.Raylib.GetShapesTexture;
-		compiler.AddSymbol("GetShapesTexture", GetShapesTexture);
+		symbols.AddSymbol("GetShapesTexture", GetShapesTexture);
 		function RaylibBeef.Rectangle() GetShapesTextureRectangle = => RaylibBeef.Raylib.GetShapesTextureRectangle;
-		compiler.AddSymbol("GetShapesTextureRectangle", GetShapesTextureRectangle);
+		symbols.AddSymbol("GetShapesTextureRectangle", GetShapesTextureRectangle);
 		function RaylibBeef.Image(char8* _fileName) LoadImage = => RaylibBeef.Raylib.LoadImage;
-		compiler.AddSymbol("LoadImage", LoadImage);
+		symbols.AddSymbol("LoadImage", LoadImage);
 		function RaylibBeef.Image(char8* _fileName, int32 _width, int32 _height, int32 _format, int32 _headerSize) LoadImageRaw = => RaylibBeef.Raylib.LoadImageRaw;
-		compiler.AddSymbol("LoadImageRaw", LoadImageRaw);
+		symbols.AddSymbol("LoadImageRaw", LoadImageRaw);
 		function RaylibBeef.Image(char8* _fileName, int32* _frames) LoadImageAnim = => RaylibBeef.Raylib.LoadImageAnim;
-		compiler.AddSymbol("LoadImageAnim", LoadImageAnim);
+		symbols.AddSymbol("LoadImageAnim", LoadImageAnim);
 		function RaylibBeef.Image(char8* _fileType, char8* _fileData, int32 _dataSize, int32* _frames) LoadImageAnimFromMemory = => RaylibBeef.Raylib.LoadImageAnimFromMemory;
-		compiler.AddSymbol("LoadImageAnimFromMemory", LoadImageAnimFromMemory);
+		symbols.AddSymbol("LoadImageAnimFromMemory", LoadImageAnimFromMemory);
 		function RaylibBeef.Image(char8* _fileType, char8* _fileData, int32 _dataSize) LoadImageFromMemory = => RaylibBeef.Raylib.LoadImageFromMemory;
-		compiler.AddSymbol("LoadImageFromMemory", LoadImageFromMemory);
+		symbols.AddSymbol("LoadImageFromMemory", LoadImageFromMemory);
 		function RaylibBeef.Image() LoadImageFromScreen = => RaylibBeef.Raylib.LoadImageFromScreen;
-		compiler.AddSymbol("LoadImageFromScreen", LoadImageFromScreen);
+		symbols.AddSymbol("LoadImageFromScreen", LoadImageFromScreen);
 		function RaylibBeef.Image(int32 _width, int32 _height, float _factor) GenImageWhiteNoise = => RaylibBeef.Raylib.GenImageWhiteNoise;
-		compiler.AddSymbol("GenImageWhiteNoise", GenImageWhiteNoise);
+		symbols.AddSymbol("GenImageWhiteNoise", GenImageWhiteNoise);
 		function RaylibBeef.Image(int32 _width, int32 _height, int32 _offsetX, int32 _offsetY, float _scale) GenImagePerlinNoise = => RaylibBeef.Raylib.GenImagePerlinNoise;
-		compiler.AddSymbol("GenImagePerlinNoise", GenImagePerlinNoise);
+		symbols.AddSymbol("GenImagePerlinNoise", GenImagePerlinNoise);
 		function RaylibBeef.Image(int32 _width, int32 _height, int32 _tileSize) GenImageCellular = => RaylibBeef.Raylib.GenImageCellular;
-		compiler.AddSymbol("GenImageCellular", GenImageCellular);
+		symbols.AddSymbol("GenImageCellular", GenImageCellular);
 		function RaylibBeef.Image(int32 _width, int32 _height, char8* _text) GenImageText = => RaylibBeef.Raylib.GenImageText;
-		compiler.AddSymbol("GenImageText", GenImageText);
+		symbols.AddSymbol("GenImageText", GenImageText);
 		function void(RaylibBeef.Image* _image, int32 _newFormat) ImageFormat = => RaylibBeef.Raylib.ImageFormat;
-		compiler.AddSymbol("ImageFormat", ImageFormat);
+		symbols.AddSymbol("ImageFormat", ImageFormat);
 		function void(RaylibBeef.Image* _image, float _threshold) ImageAlphaCrop = => RaylibBeef.Raylib.ImageAlphaCrop;
-		compiler.AddSymbol("ImageAlphaCrop", ImageAlphaCrop);
+		symbols.AddSymbol("ImageAlphaCrop", ImageAlphaCrop);
 		function void(RaylibBeef.Image* _image) ImageAlphaPremultiply = => RaylibBeef.Raylib.ImageAlphaPremultiply;
-		compiler.AddSymbol("ImageAlphaPremultiply", ImageAlphaPremultiply);
+		symbols.AddSymbol("ImageAlphaPremultiply", ImageAlphaPremultiply);
 		function void(RaylibBeef.Image* _image, int32 _blurSize) ImageBlurGaussian = => RaylibBeef.Raylib.ImageBlurGaussian;
-		compiler.AddSymbol("ImageBlurGaussian", ImageBlurGaussian);
+		symbols.AddSymbol("ImageBlurGaussian", ImageBlurGaussian);
 		function void(RaylibBeef.Image* _image, float* _kernel, int32 _kernelSize) ImageKernelConvolution = => RaylibBeef.Raylib.ImageKernelConvolution;
-		compiler.AddSymbol("ImageKernelConvolution", ImageKernelConvolution);
+		symbols.AddSymbol("ImageKernelConvolution", ImageKernelConvolution);
 		function void(RaylibBeef.Image* _image, int32 _newWidth, int32 _newHeight) ImageResize = => RaylibBeef.Raylib.ImageResize;
-		compiler.AddSymbol("ImageResize", ImageResize);
+		symbols.AddSymbol("ImageResize", ImageResize);
 		function void(RaylibBeef.Image* _image, int32 _newWidth, int32 _newHeight) ImageResizeNN = => RaylibBeef.Raylib.ImageResizeNN;
-		compiler.AddSymbol("ImageResizeNN", ImageResizeNN);
+		symbols.AddSymbol("ImageResizeNN", ImageResizeNN);
 		function void(RaylibBeef.Image* _image) ImageMipmaps = => RaylibBeef.Raylib.ImageMipmaps;
-		compiler.AddSymbol("ImageMipmaps", ImageMipmaps);
+		symbols.AddSymbol("ImageMipmaps", ImageMipmaps);
 		function void(RaylibBeef.Image* _image, int32 _rBpp, int32 _gBpp, int32 _bBpp, int32 _aBpp) ImageDither = => RaylibBeef.Raylib.ImageDither;
-		compiler.AddSymbol("ImageDither", ImageDither);
+		symbols.AddSymbol("ImageDither", ImageDither);
 		function void(RaylibBeef.Image* _image) ImageFlipVertical = => RaylibBeef.Raylib.ImageFlipVertical;
-		compiler.AddSymbol("ImageFlipVertical", ImageFlipVertical);
+		symbols.AddSymbol("ImageFlipVertical", ImageFlipVertical);
 		function void(RaylibBeef.Image* _image) ImageFlipHorizontal = => RaylibBeef.Raylib.ImageFlipHorizontal;
-		compiler.AddSymbol("ImageFlipHorizontal", ImageFlipHorizontal);
+		symbols.AddSymbol("ImageFlipHorizontal", ImageFlipHorizontal);
 		function void(RaylibBeef.Image* _image, int32 _degrees) ImageRotate = => RaylibBeef.Raylib.ImageRotate;
-		compiler.AddSymbol("ImageRotate", ImageRotate);
+		symbols.AddSymbol("ImageRotate", ImageRotate);
 		function void(RaylibBeef.Image* _image) ImageRotateCW = => RaylibBeef.Raylib.ImageRotateCW;
-		compiler.AddSymbol("ImageRotateCW", ImageRotateCW);
+		symbols.AddSymbol("ImageRotateCW", ImageRotateCW);
 		function void(RaylibBeef.Image* _image) ImageRotateCCW = => RaylibBeef.Raylib.ImageRotateCCW;
-		compiler.AddSymbol("ImageRotateCCW", ImageRotateCCW);
+		symbols.AddSymbol("ImageRotateCCW", ImageRotateCCW);
 		function void(RaylibBeef.Image* _image) ImageColorInvert = => RaylibBeef.Raylib.ImageColorInvert;
-		compiler.AddSymbol("ImageColorInvert", ImageColorInvert);
+		symbols.AddSymbol("ImageColorInvert", ImageColorInvert);
 		function void(RaylibBeef.Image* _image) ImageColorGrayscale = => RaylibBeef.Raylib.ImageColorGrayscale;
-		compiler.AddSymbol("ImageColorGrayscale", ImageColorGrayscale);
+		symbols.AddSymbol("ImageColorGrayscale", ImageColorGrayscale);
 		function void(RaylibBeef.Image* _image, float _contrast) ImageColorContrast = => RaylibBeef.Raylib.ImageColorContrast;
-		compiler.AddSymbol("ImageColorContrast", ImageColorContrast);
+		symbols.AddSymbol("ImageColorContrast", ImageColorContrast);
 		function void(RaylibBeef.Image* _image, int32 _brightness) ImageColorBrightness = => RaylibBeef.Raylib.ImageColorBrightness;
-		compiler.AddSymbol("ImageColorBrightness", ImageColorBrightness);
+		symbols.AddSymbol("ImageColorBrightness", ImageColorBrightness);
 		function void(RaylibBeef.Color* _colors) UnloadImageColors = => RaylibBeef.Raylib.UnloadImageColors;
-		compiler.AddSymbol("UnloadImageColors", UnloadImageColors);
+		symbols.AddSymbol("UnloadImageColors", UnloadImageColors);
 		function void(RaylibBeef.Color* _colors) UnloadImagePalette = => RaylibBeef.Raylib.UnloadImagePalette;
-		compiler.AddSymbol("UnloadImagePalette", UnloadImagePalette);
+		symbols.AddSymbol("UnloadImagePalette", UnloadImagePalette);
 		function RaylibBeef.Texture(char8* _fileName) LoadTexture = => RaylibBeef.Raylib.LoadTexture;
-		compiler.AddSymbol("LoadTexture", LoadTexture);
+		symbols.AddSymbol("LoadTexture", LoadTexture);
 		function RaylibBeef.RenderTexture(int32 _width, int32 _height) LoadRenderTexture = => RaylibBeef.Raylib.LoadRenderTexture;
-		compiler.AddSymbol("LoadRenderTexture", LoadRenderTexture);
+		symbols.AddSymbol("LoadRenderTexture", LoadRenderTexture);
 		function void(RaylibBeef.Texture* _texture) GenTextureMipmaps = => RaylibBeef.Raylib.GenTextureMipmaps;
-		compiler.AddSymbol("GenTextureMipmaps", GenTextureMipmaps);
+		symbols.AddSymbol("GenTextureMipmaps", GenTextureMipmaps);
 		function RaylibBeef.Color(float _hue, float _saturation, float _value) ColorFromHSV = => RaylibBeef.Raylib.ColorFromHSV;
-		compiler.AddSymbol("ColorFromHSV", ColorFromHSV);
+		symbols.AddSymbol("ColorFromHSV", ColorFromHSV);
 		function RaylibBeef.Color(int32 _hexValue) GetColor = => RaylibBeef.Raylib.GetColor;
-		compiler.AddSymbol("GetColor", GetColor);
+		symbols.AddSymbol("GetColor", GetColor);
 		function RaylibBeef.Color(void* _srcPtr, int32 _format) GetPixelColor = => RaylibBeef.Raylib.GetPixelColor;
-		compiler.AddSymbol("GetPixelColor", GetPixelColor);
+		symbols.AddSymbol("GetPixelColor", GetPixelColor);
 		function int32(int32 _width, int32 _height, int32 _format) GetPixelDataSize = => RaylibBeef.Raylib.GetPixelDataSize;
-		compiler.AddSymbol("GetPixelDataSize", GetPixelDataSize);
+		symbols.AddSymbol("GetPixelDataSize", GetPixelDataSize);
 		function RaylibBeef.Font() GetFontDefault = => RaylibBeef.Raylib.GetFontDefault;
-		compiler.AddSymbol("GetFontDefault", GetFontDefault);
+		symbols.AddSymbol("GetFontDefault", GetFontDefault);
 		function RaylibBeef.Font(char8* _fileName) LoadFont = => RaylibBeef.Raylib.LoadFont;
-		compiler.AddSymbol("LoadFont", LoadFont);
+		symbols.AddSymbol("LoadFont", LoadFont);
 		function RaylibBeef.Font(char8* _fileName, int32 _fontSize, int32* _codepoints, int32 _codepointCount) LoadFontEx = => RaylibBeef.Raylib.LoadFontEx;
-		compiler.AddSymbol("LoadFontEx", LoadFontEx);
+		symbols.AddSymbol("LoadFontEx", LoadFontEx);
 		function RaylibBeef.Font(char8* _fileType, char8* _fileData, int32 _dataSize, int32 _fontSize, int32* _codepoints, int32 _codepointCount) LoadFontFromMemory = => RaylibBeef.Raylib.LoadFontFromMemory;
-		compiler.AddSymbol("LoadFontFromMemory", LoadFontFromMemory);
+		symbols.AddSymbol("LoadFontFromMemory", LoadFontFromMemory);
 		function RaylibBeef.GlyphInfo*(char8* _fileData, int32 _dataSize, int32 _fontSize, int32* _codepoints, int32 _codepointCount, int32 _type) LoadFontData = => RaylibBeef.Raylib.LoadFontData;
-		compiler.AddSymbol("LoadFontData", LoadFontData);
+		symbols.AddSymbol("LoadFontData", LoadFontData);
 		function RaylibBeef.Image(RaylibBeef.GlyphInfo* _glyphs, RaylibBeef.Rectangle** _glyphRecs, int32 _glyphCount, int32 _fontSize, int32 _padding, int32 _packMethod) GenImageFontAtlas = => RaylibBeef.Raylib.GenImageFontAtlas;
-		compiler.AddSymbol("GenImageFontAtlas", GenImageFontAtlas);
+		symbols.AddSymbol("GenImageFontAtlas", GenImageFontAtlas);
 		function void(RaylibBeef.GlyphInfo* _glyphs, int32 _glyphCount) UnloadFontData = => RaylibBeef.Raylib.UnloadFontData;
-		compiler.AddSymbol("UnloadFontData", UnloadFontData);
+		symbols.AddSymbol("UnloadFontData", UnloadFontData);
 		function void(int32 _posX, int32 _posY) DrawFPS = => RaylibBeef.Raylib.DrawFPS;
-		compiler.AddSymbol("DrawFPS", DrawFPS);
+		symbols.AddSymbol("DrawFPS", DrawFPS);
 		function void(int32 _spacing) SetTextLineSpacing = => RaylibBeef.Raylib.SetTextLineSpacing;
-		compiler.AddSymbol("SetTextLineSpacing", SetTextLineSpacing);
+		symbols.AddSymbol("SetTextLineSpacing", SetTextLineSpacing);
 		function int32(char8* _text, int32 _fontSize) MeasureText = => RaylibBeef.Raylib.MeasureText;
-		compiler.AddSymbol("MeasureText", MeasureText);
+		symbols.AddSymbol("MeasureText", MeasureText);
 		function char8*(int32* _codepoints, int32 _length) LoadUTF8 = => RaylibBeef.Raylib.LoadUTF8;
-		compiler.AddSymbol("LoadUTF8", LoadUTF8);
+		symbols.AddSymbol("LoadUTF8", LoadUTF8);
 		function void(char8* _text) UnloadUTF8 = => RaylibBeef.Raylib.UnloadUTF8;
-		compiler.AddSymbol("UnloadUTF8", UnloadUTF8);
+		symbols.AddSymbol("UnloadUTF8", UnloadUTF8);
 		function int32*(char8* _text, int32* _count) LoadCodepoints = => RaylibBeef.Raylib.LoadCodepoints;
-		compiler.AddSymbol("LoadCodepoints", LoadCodepoints);
+		symbols.AddSymbol("LoadCodepoints", LoadCodepoints);
 		function void(int32* _codepoints) UnloadCodepoints = => RaylibBeef.Raylib.UnloadCodepoints;
-		compiler.AddSymbol("UnloadCodepoints", UnloadCodepoints);
+		symbols.AddSymbol("UnloadCodepoints", UnloadCodepoints);
 		function int32(char8* _text) GetCodepointCount = => RaylibBeef.Raylib.GetCodepointCount;
-		compiler.AddSymbol("GetCodepointCount", GetCodepointCount);
+		symbols.AddSymbol("GetCodepointCount", GetCodepointCount);
 		function int32(char8* _text, int32* _codepointSize) GetCodepoint = => RaylibBeef.Raylib.GetCodepoint;
-		compiler.AddSymbol("GetCodepoint", GetCodepoint);
+		symbols.AddSymbol("GetCodepoint", GetCodepoint);
 		function int32(char8* _text, int32* _codepointSize) GetCodepointNext = => RaylibBeef.Raylib.GetCodepointNext;
-		compiler.AddSymbol("GetCodepointNext", GetCodepointNext);
+		symbols.AddSymbol("GetCodepointNext", GetCodepointNext);
 		function int32(char8* _text, int32* _codepointSize) GetCodepointPrevious = => RaylibBeef.Raylib.GetCodepointPrevious;
-		compiler.AddSymbol("GetCodepointPrevious", GetCodepointPrevious);
+		symbols.AddSymbol("GetCodepointPrevious", GetCodepointPrevious);
 		function char8*(int32 _codepoint, int32* _utf8Size) CodepointToUTF8 = => RaylibBeef.Raylib.CodepointToUTF8;
-		compiler.AddSymbol("CodepointToUTF8", CodepointToUTF8);
+		symbols.AddSymbol("CodepointToUTF8", CodepointToUTF8);
 		function int32(char8* _dst, char8* _src) TextCopy = => RaylibBeef.Raylib.TextCopy;
-		compiler.AddSymbol("TextCopy", TextCopy);
+		symbols.AddSymbol("TextCopy", TextCopy);
 		function bool(char8* _text1, char8* _text2) TextIsEqual = => RaylibBeef.Raylib.TextIsEqual;
-		compiler.AddSymbol("TextIsEqual", TextIsEqual);
+		symbols.AddSymbol("TextIsEqual", TextIsEqual);
 		function int32(char8* _text) TextLength = => RaylibBeef.Raylib.TextLength;
-		compiler.AddSymbol("TextLength", TextLength);
+		symbols.AddSymbol("TextLength", TextLength);
 		function char8*(char8* _text) TextFormat = => RaylibBeef.Raylib.TextFormat;
-		compiler.AddSymbol("TextFormat", TextFormat);
+		symbols.AddSymbol("TextFormat", TextFormat);
 		function char8*(char8* _text, int32 _position, int32 _length) TextSubtext = => RaylibBeef.Raylib.TextSubtext;
-		compiler.AddSymbol("TextSubtext", TextSubtext);
+		symbols.AddSymbol("TextSubtext", TextSubtext);
 		function char8*(char8* _text, char8* _replace, char8* _by) TextReplace = => RaylibBeef.Raylib.TextReplace;
-		compiler.AddSymbol("TextReplace", TextReplace);
+		symbols.AddSymbol("TextReplace", TextReplace);
 		function char8*(char8* _text, char8* _insert, int32 _position) TextInsert = => RaylibBeef.Raylib.TextInsert;
-		compiler.AddSymbol("TextInsert", TextInsert);
+		symbols.AddSymbol("TextInsert", TextInsert);
 		function char8*(char8** _textList, int32 _count, char8* _delimiter) TextJoin = => RaylibBeef.Raylib.TextJoin;
-		compiler.AddSymbol("TextJoin", TextJoin);
+		symbols.AddSymbol("TextJoin", TextJoin);
 		function char8**(char8* _text, char8 _delimiter, int32* _count) TextSplit = => RaylibBeef.Raylib.TextSplit;
-		compiler.AddSymbol("TextSplit", TextSplit);
+		symbols.AddSymbol("TextSplit", TextSplit);
 		function void(char8* _text, char8* _append, int32* _position) TextAppend = => RaylibBeef.Raylib.TextAppend;
-		compiler.AddSymbol("TextAppend", TextAppend);
+		symbols.AddSymbol("TextAppend", TextAppend);
 		function int32(char8* _text, char8* _find) TextFindIndex = => RaylibBeef.Raylib.TextFindIndex;
-		compiler.AddSymbol("TextFindIndex", TextFindIndex);
+		symbols.AddSymbol("TextFindIndex", TextFindIndex);
 		function char8*(char8* _text) TextToUpper = => RaylibBeef.Raylib.TextToUpper;
-		compiler.AddSymbol("TextToUpper", TextToUpper);
+		symbols.AddSymbol("TextToUpper", TextToUpper);
 		function char8*(char8* _text) TextToLower = => RaylibBeef.Raylib.TextToLower;
-		compiler.AddSymbol("TextToLower", TextToLower);
+		symbols.AddSymbol("TextToLower", TextToLower);
 		function char8*(char8* _text) TextToPascal = => RaylibBeef.Raylib.TextToPascal;
-		compiler.AddSymbol("TextToPascal", TextToPascal);
+		symbols.AddSymbol("TextToPascal", TextToPascal);
 		function char8*(char8* _text) TextToSnake = => RaylibBeef.Raylib.TextToSnake;
-		compiler.AddSymbol("TextToSnake", TextToSnake);
+		symbols.AddSymbol("TextToSnake", TextToSnake);
 		function char8*(char8* _text) TextToCamel = => RaylibBeef.Raylib.TextToCamel;
-		compiler.AddSymbol("TextToCamel", TextToCamel);
+		symbols.AddSymbol("TextToCamel", TextToCamel);
 		function int32(char8* _text) TextToInteger = => RaylibBeef.Raylib.TextToInteger;
-		compiler.AddSymbol("TextToInteger", TextToInteger);
+		symbols.AddSymbol("TextToInteger", TextToInteger);
 		function float(char8* _text) TextToFloat = => RaylibBeef.Raylib.TextToFloat;
-		compiler.AddSymbol("TextToFloat", TextToFloat);
+		symbols.AddSymbol("TextToFloat", TextToFloat);
 		function void(int32 _slices, float _spacing) DrawGrid = => RaylibBeef.Raylib.DrawGrid;
-		compiler.AddSymbol("DrawGrid", DrawGrid);
+		symbols.AddSymbol("DrawGrid", DrawGrid);
 		function RaylibBeef.Model(char8* _fileName) LoadModel = => RaylibBeef.Raylib.LoadModel;
-		compiler.AddSymbol("LoadModel", LoadModel);
+		symbols.AddSymbol("LoadModel", LoadModel);
 		function void(RaylibBeef.Mesh* _mesh, bool _dynamic) UploadMesh = => RaylibBeef.Raylib.UploadMesh;
-		compiler.AddSymbol("UploadMesh", UploadMesh);
+		symbols.AddSymbol("UploadMesh", UploadMesh);
 		function void(RaylibBeef.Mesh* _mesh) GenMeshTangents = => RaylibBeef.Raylib.GenMeshTangents;
-		compiler.AddSymbol("GenMeshTangents", GenMeshTangents);
+		symbols.AddSymbol("GenMeshTangents", GenMeshTangents);
 		function RaylibBeef.Mesh(int32 _sides, float _radius) GenMeshPoly = => RaylibBeef.Raylib.GenMeshPoly;
-		compiler.AddSymbol("GenMeshPoly", GenMeshPoly);
+		symbols.AddSymbol("GenMeshPoly", GenMeshPoly);
 		function RaylibBeef.Mesh(float _width, float _length, int32 _resX, int32 _resZ) GenMeshPlane = => RaylibBeef.Raylib.GenMeshPlane;
-		compiler.AddSymbol("GenMeshPlane", GenMeshPlane);
+		symbols.AddSymbol("GenMeshPlane", GenMeshPlane);
 		function RaylibBeef.Mesh(float _width, float _height, float _length) GenMeshCube = => RaylibBeef.Raylib.GenMeshCube;
-		compiler.AddSymbol("GenMeshCube", GenMeshCube);
+		symbols.AddSymbol("GenMeshCube", GenMeshCube);
 		function RaylibBeef.Mesh(float _radius, int32 _rings, int32 _slices) GenMeshSphere = => RaylibBeef.Raylib.GenMeshSphere;
-		compiler.AddSymbol("GenMeshSphere", GenMeshSphere);
+		symbols.AddSymbol("GenMeshSphere", GenMeshSphere);
 		function RaylibBeef.Mesh(float _radius, int32 _rings, int32 _slices) GenMeshHemiSphere = => RaylibBeef.Raylib.GenMeshHemiSphere;
-		compiler.AddSymbol("GenMeshHemiSphere", GenMeshHemiSphere);
+		symbols.AddSymbol("GenMeshHemiSphere", GenMeshHemiSphere);
 		function RaylibBeef.Mesh(float _radius, float _height, int32 _slices) GenMeshCylinder = => RaylibBeef.Raylib.GenMeshCylinder;
-		compiler.AddSymbol("GenMeshCylinder", GenMeshCylinder);
+		symbols.AddSymbol("GenMeshCylinder", GenMeshCylinder);
 		function RaylibBeef.Mesh(float _radius, float _height, int32 _slices) GenMeshCone = => RaylibBeef.Raylib.GenMeshCone;
-		compiler.AddSymbol("GenMeshCone", GenMeshCone);
+		symbols.AddSymbol("GenMeshCone", GenMeshCone);
 		function RaylibBeef.Mesh(float _radius, float _size, int32 _radSeg, int32 _sides) GenMeshTorus = => RaylibBeef.Raylib.GenMeshTorus;
-		compiler.AddSymbol("GenMeshTorus", GenMeshTorus);
+		symbols.AddSymbol("GenMeshTorus", GenMeshTorus);
 		function RaylibBeef.Mesh(float _radius, float _size, int32 _radSeg, int32 _sides) GenMeshKnot = => RaylibBeef.Raylib.GenMeshKnot;
-		compiler.AddSymbol("GenMeshKnot", GenMeshKnot);
+		symbols.AddSymbol("GenMeshKnot", GenMeshKnot);
 		function RaylibBeef.Material*(char8* _fileName, int32* _materialCount) LoadMaterials = => RaylibBeef.Raylib.LoadMaterials;
-		compiler.AddSymbol("LoadMaterials", LoadMaterials);
+		symbols.AddSymbol("LoadMaterials", LoadMaterials);
 		function RaylibBeef.Material() LoadMaterialDefault = => RaylibBeef.Raylib.LoadMaterialDefault;
-		compiler.AddSymbol("LoadMaterialDefault", LoadMaterialDefault);
+		symbols.AddSymbol("LoadMaterialDefault", LoadMaterialDefault);
 		function void(RaylibBeef.Model* _model, int32 _meshId, int32 _materialId) SetModelMeshMaterial = => RaylibBeef.Raylib.SetModelMeshMaterial;
-		compiler.AddSymbol("SetModelMeshMaterial", SetModelMeshMaterial);
+		symbols.AddSymbol("SetModelMeshMaterial", SetModelMeshMaterial);
 		function RaylibBeef.ModelAnimation*(char8* _fileName, int32* _animCount) LoadModelAnimations = => RaylibBeef.Raylib.LoadModelAnimations;
-		compiler.AddSymbol("LoadModelAnimations", LoadModelAnimations);
+		symbols.AddSymbol("LoadModelAnimations", LoadModelAnimations);
 		function void(RaylibBeef.ModelAnimation* _animations, int32 _animCount) UnloadModelAnimations = => RaylibBeef.Raylib.UnloadModelAnimations;
-		compiler.AddSymbol("UnloadModelAnimations", UnloadModelAnimations);
+		symbols.AddSymbol("UnloadModelAnimations", UnloadModelAnimations);
 		function void() InitAudioDevice = => RaylibBeef.Raylib.InitAudioDevice;
-		compiler.AddSymbol("InitAudioDevice", InitAudioDevice);
+		symbols.AddSymbol("InitAudioDevice", InitAudioDevice);
 		function void() CloseAudioDevice = => RaylibBeef.Raylib.CloseAudioDevice;
-		compiler.AddSymbol("CloseAudioDevice", CloseAudioDevice);
+		symbols.AddSymbol("CloseAudioDevice", CloseAudioDevice);
 		function bool() IsAudioDeviceReady = => RaylibBeef.Raylib.IsAudioDeviceReady;
-		compiler.AddSymbol("IsAudioDeviceReady", IsAudioDeviceReady);
+		symbols.AddSymbol("IsAudioDeviceReady", IsAudioDeviceReady);
 		function void(float _volume) SetMasterVolume = => RaylibBeef.Raylib.SetMasterVolume;
-		compiler.AddSymbol("SetMasterVolume", SetMasterVolume);
+		symbols.AddSymbol("SetMasterVolume", SetMasterVolume);
 		function float() GetMasterVolume = => RaylibBeef.Raylib.GetMasterVolume;
-		compiler.AddSymbol("GetMasterVolume", GetMasterVolume);
+		symbols.AddSymbol("GetMasterVolume", GetMasterVolume);
 		function RaylibBeef.Wave(char8* _fileName) LoadWave = => RaylibBeef.Raylib.LoadWave;
-		compiler.AddSymbol("LoadWave", LoadWave);
+		symbols.AddSymbol("LoadWave", LoadWave);
 		function RaylibBeef.Wave(char8* _fileType, char8* _fileData, int32 _dataSize) LoadWaveFromMemory = => RaylibBeef.Raylib.LoadWaveFromMemory;
-		compiler.AddSymbol("LoadWaveFromMemory", LoadWaveFromMemory);
+		symbols.AddSymbol("LoadWaveFromMemory", LoadWaveFromMemory);
 		function RaylibBeef.Sound(char8* _fileName) LoadSound = => RaylibBeef.Raylib.LoadSound;
-		compiler.AddSymbol("LoadSound", LoadSound);
+		symbols.AddSymbol("LoadSound", LoadSound);
 		function void(RaylibBeef.Wave* _wave, int32 _initFrame, int32 _finalFrame) WaveCrop = => RaylibBeef.Raylib.WaveCrop;
-		compiler.AddSymbol("WaveCrop", WaveCrop);
+		symbols.AddSymbol("WaveCrop", WaveCrop);
 		function void(RaylibBeef.Wave* _wave, int32 _sampleRate, int32 _sampleSize, int32 _channels) WaveFormat = => RaylibBeef.Raylib.WaveFormat;
-		compiler.AddSymbol("WaveFormat", WaveFormat);
+		symbols.AddSymbol("WaveFormat", WaveFormat);
 		function void(float* _samples) UnloadWaveSamples = => RaylibBeef.Raylib.UnloadWaveSamples;
-		compiler.AddSymbol("UnloadWaveSamples", UnloadWaveSamples);
+		symbols.AddSymbol("UnloadWaveSamples", UnloadWaveSamples);
 		function RaylibBeef.Music(char8* _fileName) LoadMusicStream = => RaylibBeef.Raylib.LoadMusicStream;
-		compiler.AddSymbol("LoadMusicStream", LoadMusicStream);
+		symbols.AddSymbol("LoadMusicStream", LoadMusicStream);
 		function RaylibBeef.Music(char8* _fileType, char8* _data, int32 _dataSize) LoadMusicStreamFromMemory = => RaylibBeef.Raylib.LoadMusicStreamFromMemory;
-		compiler.AddSymbol("LoadMusicStreamFromMemory", LoadMusicStreamFromMemory);
+		symbols.AddSymbol("LoadMusicStreamFromMemory", LoadMusicStreamFromMemory);
 		function RaylibBeef.AudioStream(int32 _sampleRate, int32 _sampleSize, int32 _channels) LoadAudioStream = => RaylibBeef.Raylib.LoadAudioStream;
-		compiler.AddSymbol("LoadAudioStream", LoadAudioStream);
+		symbols.AddSymbol("LoadAudioStream", LoadAudioStream);
 		function void(int32 _size) SetAudioStreamBufferSizeDefault = => RaylibBeef.Raylib.SetAudioStreamBufferSizeDefault;
-		compiler.AddSymbol("SetAudioStreamBufferSizeDefault", SetAudioStreamBufferSizeDefault);
+		symbols.AddSymbol("SetAudioStreamBufferSizeDefault", SetAudioStreamBufferSizeDefault);
 		function void(RaylibBeef.Raylib.AudioCallback _processor) AttachAudioMixedProcessor = => RaylibBeef.Raylib.AttachAudioMixedProcessor;
-		compiler.AddSymbol("AttachAudioMixedProcessor", AttachAudioMixedProcessor);
+		symbols.AddSymbol("AttachAudioMixedProcessor", AttachAudioMixedProcessor);
 		function void(RaylibBeef.Raylib.AudioCallback _processor) DetachAudioMixedProcessor = => RaylibBeef.Raylib.DetachAudioMixedProcessor;
-		compiler.AddSymbol("DetachAudioMixedProcessor", DetachAudioMixedProcessor);
+		symbols.AddSymbol("DetachAudioMixedProcessor", DetachAudioMixedProcessor);
 		function void(RaylibBeef.Image _image) SetWindowIcon = => RaylibBeef.Raylib.SetWindowIcon;
-		compiler.AddSymbol("SetWindowIcon", SetWindowIcon);
+		symbols.AddSymbol("SetWindowIcon", SetWindowIcon);
 		function void(RaylibBeef.Color _color) ClearBackground = => RaylibBeef.Raylib.ClearBackground;
-		compiler.AddSymbol("ClearBackground", ClearBackground);
+		symbols.AddSymbol("ClearBackground", ClearBackground);
 		function void(RaylibBeef.Camera2D _camera) BeginMode2D = => RaylibBeef.Raylib.BeginMode2D;
-		compiler.AddSymbol("BeginMode2D", BeginMode2D);
+		symbols.AddSymbol("BeginMode2D", BeginMode2D);
 		function void(RaylibBeef.Camera3D _camera) BeginMode3D = => RaylibBeef.Raylib.BeginMode3D;
-		compiler.AddSymbol("BeginMode3D", BeginMode3D);
+		symbols.AddSymbol("BeginMode3D", BeginMode3D);
 		function void(RaylibBeef.RenderTexture _target) BeginTextureMode = => RaylibBeef.Raylib.BeginTextureMode;
-		compiler.AddSymbol("BeginTextureMode", BeginTextureMode);
+		symbols.AddSymbol("BeginTextureMode", BeginTextureMode);
 		function void(RaylibBeef.Shader _shader) BeginShaderMode = => RaylibBeef.Raylib.BeginShaderMode;
-		compiler.AddSymbol("BeginShaderMode", BeginShaderMode);
+		symbols.AddSymbol("BeginShaderMode", BeginShaderMode);
 		function void(RaylibBeef.VrStereoConfig _config) BeginVrStereoMode = => RaylibBeef.Raylib.BeginVrStereoMode;
-		compiler.AddSymbol("BeginVrStereoMode", BeginVrStereoMode);
+		symbols.AddSymbol("BeginVrStereoMode", BeginVrStereoMode);
 		function RaylibBeef.VrStereoConfig(RaylibBeef.VrDeviceInfo _device) LoadVrStereoConfig = => RaylibBeef.Raylib.LoadVrStereoConfig;
-		compiler.AddSymbol("LoadVrStereoConfig", LoadVrStereoConfig);
+		symbols.AddSymbol("LoadVrStereoConfig", LoadVrStereoConfig);
 		function void(RaylibBeef.VrStereoConfig _config) UnloadVrStereoConfig = => RaylibBeef.Raylib.UnloadVrStereoConfig;
-		compiler.AddSymbol("UnloadVrStereoConfig", UnloadVrStereoConfig);
+		symbols.AddSymbol("UnloadVrStereoConfig", UnloadVrStereoConfig);
 		function bool(RaylibBeef.Shader _shader) IsShaderValid = => RaylibBeef.Raylib.IsShaderValid;
-		compiler.AddSymbol("IsShaderValid", IsShaderValid);
+		symbols.AddSymbol("IsShaderValid", IsShaderValid);
 		function int32(RaylibBeef.Shader _shader, char8* _uniformName) GetShaderLocation = => RaylibBeef.Raylib.GetShaderLocation;
-		compiler.AddSymbol("GetShaderLocation", GetShaderLocation);
+		symbols.AddSymbol("GetShaderLocation", GetShaderLocation);
 		function int32(RaylibBeef.Shader _shader, char8* _attribName) GetShaderLocationAttrib = => RaylibBeef.Raylib.GetShaderLocationAttrib;
-		compiler.AddSymbol("GetShaderLocationAttrib", GetShaderLocationAttrib);
+		symbols.AddSymbol("GetShaderLocationAttrib", GetShaderLocationAttrib);
 		function void(RaylibBeef.Shader _shader, int32 _locIndex, void* _value, int32 _uniformType) SetShaderValue = => RaylibBeef.Raylib.SetShaderValue;
-		compiler.AddSymbol("SetShaderValue", SetShaderValue);
+		symbols.AddSymbol("SetShaderValue", SetShaderValue);
 		function void(RaylibBeef.Shader _shader, int32 _locIndex, void* _value, int32 _uniformType, int32 _count) SetShaderValueV = => RaylibBeef.Raylib.SetShaderValueV;
-		compiler.AddSymbol("SetShaderValueV", SetShaderValueV);
+		symbols.AddSymbol("SetShaderValueV", SetShaderValueV);
 		function void(RaylibBeef.Shader _shader, int32 _locIndex, RaylibBeef.Matrix _mat) SetShaderValueMatrix = => RaylibBeef.Raylib.SetShaderValueMatrix;
-		compiler.AddSymbol("SetShaderValueMatrix", SetShaderValueMatrix);
+		symbols.AddSymbol("SetShaderValueMatrix", SetShaderValueMatrix);
 		function void(RaylibBeef.Shader _shader, int32 _locIndex, RaylibBeef.Texture _texture) SetShaderValueTexture = => RaylibBeef.Raylib.SetShaderValueTexture;
-		compiler.AddSymbol("SetShaderValueTexture", SetShaderValueTexture);
+		symbols.AddSymbol("SetShaderValueTexture", SetShaderValueTexture);
 		function void(RaylibBeef.Shader _shader) UnloadShader = => RaylibBeef.Raylib.UnloadShader;
-		compiler.AddSymbol("UnloadShader", UnloadShader);
+		symbols.AddSymbol("UnloadShader", UnloadShader);
 		function RaylibBeef.Ray(RaylibBeef.Vector2 _position, RaylibBeef.Camera3D _camera) GetScreenToWorldRay = => RaylibBeef.Raylib.GetScreenToWorldRay;
-		compiler.AddSymbol("GetScreenToWorldRay", GetScreenToWorldRay);
+		symbols.AddSymbol("GetScreenToWorldRay", GetScreenToWorldRay);
 		function RaylibBeef.Ray(RaylibBeef.Vector2 _position, RaylibBeef.Camera3D _camera, int32 _width, int32 _height) GetScreenToWorldRayEx = => RaylibBeef.Raylib.GetScreenToWorldRayEx;
-		compiler.AddSymbol("GetScreenToWorldRayEx", GetScreenToWorldRayEx);
+		symbols.AddSymbol("GetScreenToWorldRayEx", GetScreenToWorldRayEx);
 		function RaylibBeef.Vector2(RaylibBeef.Vector3 _position, RaylibBeef.Camera3D _camera) GetWorldToScreen = => RaylibBeef.Raylib.GetWorldToScreen;
-		compiler.AddSymbol("GetWorldToScreen", GetWorldToScreen);
+		symbols.AddSymbol("GetWorldToScreen", GetWorldToScreen);
 		function RaylibBeef.Vector2(RaylibBeef.Vector3 _position, RaylibBeef.Camera3D _camera, int32 _width, int32 _height) GetWorldToScreenEx = => RaylibBeef.Raylib.GetWorldToScreenEx;
-		compiler.AddSymbol("GetWorldToScreenEx", GetWorldToScreenEx);
+		symbols.AddSymbol("GetWorldToScreenEx", GetWorldToScreenEx);
 		function RaylibBeef.Vector2(RaylibBeef.Vector2 _position, RaylibBeef.Camera2D _camera) GetWorldToScreen2D = => RaylibBeef.Raylib.GetWorldToScreen2D;
-		compiler.AddSymbol("GetWorldToScreen2D", GetWorldToScreen2D);
+		symbols.AddSymbol("GetWorldToScreen2D", GetWorldToScreen2D);
 		function RaylibBeef.Vector2(RaylibBeef.Vector2 _position, RaylibBeef.Camera2D _camera) GetScreenToWorld2D = => RaylibBeef.Raylib.GetScreenToWorld2D;
-		compiler.AddSymbol("GetScreenToWorld2D", GetScreenToWorld2D);
+		symbols.AddSymbol("GetScreenToWorld2D", GetScreenToWorld2D);
 		function RaylibBeef.Matrix(RaylibBeef.Camera3D _camera) GetCameraMatrix = => RaylibBeef.Raylib.GetCameraMatrix;
-		compiler.AddSymbol("GetCameraMatrix", GetCameraMatrix);
+		symbols.AddSymbol("GetCameraMatrix", GetCameraMatrix);
 		function RaylibBeef.Matrix(RaylibBeef.Camera2D _camera) GetCameraMatrix2D = => RaylibBeef.Raylib.GetCameraMatrix2D;
-		compiler.AddSymbol("GetCameraMatrix2D", GetCameraMatrix2D);
+		symbols.AddSymbol("GetCameraMatrix2D", GetCameraMatrix2D);
 		function void(RaylibBeef.FilePathList _files) UnloadDirectoryFiles = => RaylibBeef.Raylib.UnloadDirectoryFiles;
-		compiler.AddSymbol("UnloadDirectoryFiles", UnloadDirectoryFiles);
+		symbols.AddSymbol("UnloadDirectoryFiles", UnloadDirectoryFiles);
 		function void(RaylibBeef.FilePathList _files) UnloadDroppedFiles = => RaylibBeef.Raylib.UnloadDroppedFiles;
-		compiler.AddSymbol("UnloadDroppedFiles", UnloadDroppedFiles);
+		symbols.AddSymbol("UnloadDroppedFiles", UnloadDroppedFiles);
 		function void(RaylibBeef.AutomationEventList _list) UnloadAutomationEventList = => RaylibBeef.Raylib.UnloadAutomationEventList;
-		compiler.AddSymbol("UnloadAutomationEventList", UnloadAutomationEventList);
+		symbols.AddSymbol("UnloadAutomationEventList", UnloadAutomationEventList);
 		function bool(RaylibBeef.AutomationEventList _list, char8* _fileName) ExportAutomationEventList = => RaylibBeef.Raylib.ExportAutomationEventList;
-		compiler.AddSymbol("ExportAutomationEventList", ExportAutomationEventList);
+		symbols.AddSymbol("ExportAutomationEventList", ExportAutomationEventList);
 		function void(RaylibBeef.AutomationEvent _event) PlayAutomationEvent = => RaylibBeef.Raylib.PlayAutomationEvent;
-		compiler.AddSymbol("PlayAutomationEvent", PlayAutomationEvent);
+		symbols.AddSymbol("PlayAutomationEvent", PlayAutomationEvent);
 		function void(RaylibBeef.Camera3D* _camera, RaylibBeef.Vector3 _movement, RaylibBeef.Vector3 _rotation, float _zoom) UpdateCameraPro = => RaylibBeef.Raylib.UpdateCameraPro;
-		compiler.AddSymbol("UpdateCameraPro", UpdateCameraPro);
+		symbols.AddSymbol("UpdateCameraPro", UpdateCameraPro);
 		function void(RaylibBeef.Texture _texture, RaylibBeef.Rectangle _source) SetShapesTexture = => RaylibBeef.Raylib.SetShapesTexture;
-		compiler.AddSymbol("SetShapesTexture", SetShapesTexture);
+		symbols.AddSymbol("SetShapesTexture", SetShapesTexture);
 		function void(int32 _posX, int32 _posY, RaylibBeef.Color _color) DrawPixel = => RaylibBeef.Raylib.DrawPixel;
-		compiler.AddSymbol("DrawPixel", DrawPixel);
+		symbols.AddSymbol("DrawPixel", DrawPixel);
 		function void(RaylibBeef.Vector2 _position, RaylibBeef.Color _color) DrawPixelV = => RaylibBeef.Raylib.DrawPixelV;
-		compiler.AddSymbol("DrawPixelV", DrawPixelV);
+		symbols.AddSymbol("DrawPixelV", DrawPixelV);
 		function void(int32 _startPosX, int32 _startPosY, int32 _endPosX, int32 _endPosY, RaylibBeef.Color _color) DrawLine = => RaylibBeef.Raylib.DrawLine;
-		compiler.AddSymbol("DrawLine", DrawLine);
+		symbols.AddSymbol("DrawLine", DrawLine);
 		function void(RaylibBeef.Vector2 _startPos, RaylibBeef.Vector2 _endPos, RaylibBeef.Color _color) DrawLineV = => RaylibBeef.Raylib.DrawLineV;
-		compiler.AddSymbol("DrawLineV", DrawLineV);
+		symbols.AddSymbol("DrawLineV", DrawLineV);
 		function void(RaylibBeef.Vector2 _startPos, RaylibBeef.Vector2 _endPos, float _thick, RaylibBeef.Color _color) DrawLineEx = => RaylibBeef.Raylib.DrawLineEx;
-		compiler.AddSymbol("DrawLineEx", DrawLineEx);
+		symbols.AddSymbol("DrawLineEx", DrawLineEx);
 		function void(RaylibBeef.Vector2* _points, int32 _pointCount, RaylibBeef.Color _color) DrawLineStrip = => RaylibBeef.Raylib.DrawLineStrip;
-		compiler.AddSymbol("DrawLineStrip", DrawLineStrip);
+		symbols.AddSymbol("DrawLineStrip", DrawLineStrip);
 		function void(RaylibBeef.Vector2 _startPos, RaylibBeef.Vector2 _endPos, float _thick, RaylibBeef.Color _color) DrawLineBezier = => RaylibBeef.Raylib.DrawLineBezier;
-		compiler.AddSymbol("DrawLineBezier", DrawLineBezier);
+		symbols.AddSymbol("DrawLineBezier", DrawLineBezier);
 		function void(int32 _centerX, int32 _centerY, float _radius, RaylibBeef.Color _color) DrawCircle = => RaylibBeef.Raylib.DrawCircle;
-		compiler.AddSymbol("DrawCircle", DrawCircle);
+		symbols.AddSymbol("DrawCircle", DrawCircle);
 		function void(RaylibBeef.Vector2 _center, float _radius, float _startAngle, float _endAngle, int32 _segments, RaylibBeef.Color _color) DrawCircleSector = => RaylibBeef.Raylib.DrawCircleSector;
-		compiler.AddSymbol("DrawCircleSector", DrawCircleSector);
+		symbols.AddSymbol("DrawCircleSector", DrawCircleSector);
 		function void(RaylibBeef.Vector2 _center, float _radius, float _startAngle, float _endAngle, int32 _segments, RaylibBeef.Color _color) DrawCircleSectorLines = => RaylibBeef.Raylib.DrawCircleSectorLines;
-		compiler.AddSymbol("DrawCircleSectorLines", DrawCircleSectorLines);
+		symbols.AddSymbol("DrawCircleSectorLines", DrawCircleSectorLines);
 		function void(int32 _centerX, int32 _centerY, float _radius, RaylibBeef.Color _inner, RaylibBeef.Color _outer) DrawCircleGradient = => RaylibBeef.Raylib.DrawCircleGradient;
-		compiler.AddSymbol("DrawCircleGradient", DrawCircleGradient);
+		symbols.AddSymbol("DrawCircleGradient", DrawCircleGradient);
 		function void(RaylibBeef.Vector2 _center, float _radius, RaylibBeef.Color _color) DrawCircleV = => RaylibBeef.Raylib.DrawCircleV;
-		compiler.AddSymbol("DrawCircleV", DrawCircleV);
+		symbols.AddSymbol("DrawCircleV", DrawCircleV);
 		function void(int32 _centerX, int32 _centerY, float _radius, RaylibBeef.Color _color) DrawCircleLines = => RaylibBeef.Raylib.DrawCircleLines;
-		compiler.AddSymbol("DrawCircleLines", DrawCircleLines);
+		symbols.AddSymbol("DrawCircleLines", DrawCircleLines);
 		function void(RaylibBeef.Vector2 _center, float _radius, RaylibBeef.Color _color) DrawCircleLinesV = => RaylibBeef.Raylib.DrawCircleLinesV;
-		compiler.AddSymbol("DrawCircleLinesV", DrawCircleLinesV);
+		symbols.AddSymbol("DrawCircleLinesV", DrawCircleLinesV);
 		function void(int32 _centerX, int32 _centerY, float _radiusH, float _radiusV, RaylibBeef.Color _color) DrawEllipse = => RaylibBeef.Raylib.DrawEllipse;
-		compiler.AddSymbol("DrawEllipse", DrawEllipse);
+		symbols.AddSymbol("DrawEllipse", DrawEllipse);
 		function void(int32 _centerX, int32 _centerY, float _radiusH, float _radiusV, RaylibBeef.Color _color) DrawEllipseLines = => RaylibBeef.Raylib.DrawEllipseLines;
-		compiler.AddSymbol("DrawEllipseLines", DrawEllipseLines);
+		symbols.AddSymbol("DrawEllipseLines", DrawEllipseLines);
 		function void(RaylibBeef.Vector2 _center, float _innerRadius, float _outerRadius, float _startAngle, float _endAngle, int32 _segments, RaylibBeef.Color _color) DrawRing = => RaylibBeef.Raylib.DrawRing;
-		compiler.AddSymbol("DrawRing", DrawRing);
+		symbols.AddSymbol("DrawRing", DrawRing);
 		function void(RaylibBeef.Vector2 _center, float _innerRadius, float _outerRadius, float _startAngle, float _endAngle, int32 _segments, RaylibBeef.Color _color) DrawRingLines = => RaylibBeef.Raylib.DrawRingLines;
-		compiler.AddSymbol("DrawRingLines", DrawRingLines);
+		symbols.AddSymbol("DrawRingLines", DrawRingLines);
 		function void(int32 _posX, int32 _posY, int32 _width, int32 _height, RaylibBeef.Color _color) DrawRectangle = => RaylibBeef.Raylib.DrawRectangle;
-		compiler.AddSymbol("DrawRectangle", DrawRectangle);
+		symbols.AddSymbol("DrawRectangle", DrawRectangle);
 		function void(RaylibBeef.Vector2 _position, RaylibBeef.Vector2 _size, RaylibBeef.Color _color) DrawRectangleV = => RaylibBeef.Raylib.DrawRectangleV;
-		compiler.AddSymbol("DrawRectangleV", DrawRectangleV);
+		symbols.AddSymbol("DrawRectangleV", DrawRectangleV);
 		function void(RaylibBeef.Rectangle _rec, RaylibBeef.Color _color) DrawRectangleRec = => RaylibBeef.Raylib.DrawRectangleRec;
-		compiler.AddSymbol("DrawRectangleRec", DrawRectangleRec);
+		symbols.AddSymbol("DrawRectangleRec", DrawRectangleRec);
 		function void(RaylibBeef.Rectangle _rec, RaylibBeef.Vector2 _origin, float _rotation, RaylibBeef.Color _color) DrawRectanglePro = => RaylibBeef.Raylib.DrawRectanglePro;
-		compiler.AddSymbol("DrawRectanglePro", DrawRectanglePro);
+		symbols.AddSymbol("DrawRectanglePro", DrawRectanglePro);
 		function void(int32 _posX, int32 _posY, int32 _width, int32 _height, RaylibBeef.Color _top, RaylibBeef.Color _bottom) DrawRectangleGradientV = => RaylibBeef.Raylib.DrawRectangleGradientV;
-		compiler.AddSymbol("DrawRectangleGradientV", DrawRectangleGradientV);
+		symbols.AddSymbol("DrawRectangleGradientV", DrawRectangleGradientV);
 		function void(int32 _posX, int32 _posY, int32 _width, int32 _height, RaylibBeef.Color _left, RaylibBeef.Color _right) DrawRectangleGradientH = => RaylibBeef.Raylib.DrawRectangleGradientH;
-		compiler.AddSymbol("DrawRectangleGradientH", DrawRectangleGradientH);
+		symbols.AddSymbol("DrawRectangleGradientH", DrawRectangleGradientH);
 		function void(RaylibBeef.Rectangle _rec, RaylibBeef.Color _topLeft, RaylibBeef.Color _bottomLeft, RaylibBeef.Color _topRight, RaylibBeef.Color _bottomRight) DrawRectangleGradientEx = => RaylibBeef.Raylib.DrawRectangleGradientEx;
-		compiler.AddSymbol("DrawRectangleGradientEx", DrawRectangleGradientEx);
+		symbols.AddSymbol("DrawRectangleGradientEx", DrawRectangleGradientEx);
 		function void(int32 _posX, int32 _posY, int32 _width, int32 _height, RaylibBeef.Color _color) DrawRectangleLines = => RaylibBeef.Raylib.DrawRectangleLines;
-		compiler.AddSymbol("DrawRectangleLines", DrawRectangleLines);
+		symbols.AddSymbol("DrawRectangleLines", DrawRectangleLines);
 		function void(RaylibBeef.Rectangle _rec, float _lineThick, RaylibBeef.Color _color) DrawRectangleLinesEx = => RaylibBeef.Raylib.DrawRectangleLinesEx;
-		compiler.AddSymbol("DrawRectangleLinesEx", DrawRectangleLinesEx);
+		symbols.AddSymbol("DrawRectangleLinesEx", DrawRectangleLinesEx);
 		function void(RaylibBeef.Rectangle _rec, float _roundness, int32 _segments, RaylibBeef.Color _color) DrawRectangleRounded = => RaylibBeef.Raylib.DrawRectangleRounded;
-		compiler.AddSymbol("DrawRectangleRounded", DrawRectangleRounded);
+		symbols.AddSymbol("DrawRectangleRounded", DrawRectangleRounded);
 		function void(RaylibBeef.Rectangle _rec, float _roundness, int32 _segments, RaylibBeef.Color _color) DrawRectangleRoundedLines = => RaylibBeef.Raylib.DrawRectangleRoundedLines;
-		compiler.AddSymbol("DrawRectangleRoundedLines", DrawRectangleRoundedLines);
+		symbols.AddSymbol("DrawRectangleRoundedLines", DrawRectangleRoundedLines);
 		function void(RaylibBeef.Rectangle _rec, float _roundness, int32 _segments, float _lineThick, RaylibBeef.Color _color) DrawRectangleRoundedLinesEx = => RaylibBeef.Raylib.DrawRectangleRoundedLinesEx;
-		compiler.AddSymbol("DrawRectangleRoundedLinesEx", DrawRectangleRoundedLinesEx);
+		symbols.AddSymbol("DrawRectangleRoundedLinesEx", DrawRectangleRoundedLinesEx);
 		function void(RaylibBeef.Vector2 _v1, RaylibBeef.Vector2 _v2, RaylibBeef.Vector2 _v3, RaylibBeef.Color _color) DrawTriangle = => RaylibBeef.Raylib.DrawTriangle;
-		compiler.AddSymbol("DrawTriangle", DrawTriangle);
+		symbols.AddSymbol("DrawTriangle", DrawTriangle);
 		function void(RaylibBeef.Vector2 _v1, RaylibBeef.Vector2 _v2, RaylibBeef.Vector2 _v3, RaylibBeef.Color _color) DrawTriangleLines = => RaylibBeef.Raylib.DrawTriangleLines;
-		compiler.AddSymbol("DrawTriangleLines", DrawTriangleLines);
+		symbols.AddSymbol("DrawTriangleLines", DrawTriangleLines);
 		function void(RaylibBeef.Vector2* _points, int32 _pointCount, RaylibBeef.Color _color) DrawTriangleFan = => RaylibBeef.Raylib.DrawTriangleFan;
-		compiler.AddSymbol("DrawTriangleFan", DrawTriangleFan);
+		symbols.AddSymbol("DrawTriangleFan", DrawTriangleFan);
 		function void(RaylibBeef.Vector2* _points, int32 _pointCount, RaylibBeef.Color _color) DrawTriangleStrip = => RaylibBeef.Raylib.DrawTriangleStrip;
-		compiler.AddSymbol("DrawTriangleStrip", DrawTriangleStrip);
+		symbols.AddSymbol("DrawTriangleStrip", DrawTriangleStrip);
 		function void(RaylibBeef.Vector2 _center, int32 _sides, float _radius, float _rotation, RaylibBeef.Color _color) DrawPoly = => RaylibBeef.Raylib.DrawPoly;
-		compiler.AddSymbol("DrawPoly", DrawPoly);
+		symbols.AddSymbol("DrawPoly", DrawPoly);
 		function void(RaylibBeef.Vector2 _center, int32 _sides, float _radius, float _rotation, RaylibBeef.Color _color) DrawPolyLines = => RaylibBeef.Raylib.DrawPolyLines;
-		compiler.AddSymbol("DrawPolyLines", DrawPolyLines);
+		symbols.AddSymbol("DrawPolyLines", DrawPolyLines);
 		function void(RaylibBeef.Vector2 _center, int32 _sides, float _radius, float _rotation, float _lineThick, RaylibBeef.Color _color) DrawPolyLinesEx = => RaylibBeef.Raylib.DrawPolyLinesEx;
-		compiler.AddSymbol("DrawPolyLinesEx", DrawPolyLinesEx);
+		symbols.AddSymbol("DrawPolyLinesEx", DrawPolyLinesEx);
 		function void(RaylibBeef.Vector2* _points, int32 _pointCount, float _thick, RaylibBeef.Color _color) DrawSplineLinear = => RaylibBeef.Raylib.DrawSplineLinear;
-		compiler.AddSymbol("DrawSplineLinear", DrawSplineLinear);
+		symbols.AddSymbol("DrawSplineLinear", DrawSplineLinear);
 		function void(RaylibBeef.Vector2* _points, int32 _pointCount, float _thick, RaylibBeef.Color _color) DrawSplineBasis = => RaylibBeef.Raylib.DrawSplineBasis;
-		compiler.AddSymbol("DrawSplineBasis", DrawSplineBasis);
+		symbols.AddSymbol("DrawSplineBasis", DrawSplineBasis);
 		function void(RaylibBeef.Vector2* _points, int32 _pointCount, float _thick, RaylibBeef.Color _color) DrawSplineCatmullRom = => RaylibBeef.Raylib.DrawSplineCatmullRom;
-		compiler.AddSymbol("DrawSplineCatmullRom", DrawSplineCatmullRom);
+		symbols.AddSymbol("DrawSplineCatmullRom", DrawSplineCatmullRom);
 		function void(RaylibBeef.Vector2* _points, int32 _pointCount, float _thick, RaylibBeef.Color _color) DrawSplineBezierQuadratic = => RaylibBeef.Raylib.DrawSplineBezierQuadratic;
-		compiler.AddSymbol("DrawSplineBezierQuadratic", DrawSplineBezierQuadratic);
+		symbols.AddSymbol("DrawSplineBezierQuadratic", DrawSplineBezierQuadratic);
 		function void(RaylibBeef.Vector2* _points, int32 _pointCount, float _thick, RaylibBeef.Color _color) DrawSplineBezierCubic = => RaylibBeef.Raylib.DrawSplineBezierCubic;
-		compiler.AddSymbol("DrawSplineBezierCubic", DrawSplineBezierCubic);
+		symbols.AddSymbol("DrawSplineBezierCubic", DrawSplineBezierCubic);
 		function void(RaylibBeef.Vector2 _p1, RaylibBeef.Vector2 _p2, float _thick, RaylibBeef.Color _color) DrawSplineSegmentLinear = => RaylibBeef.Raylib.DrawSplineSegmentLinear;
-		compiler.AddSymbol("DrawSplineSegmentLinear", DrawSplineSegmentLinear);
+		symbols.AddSymbol("DrawSplineSegmentLinear", DrawSplineSegmentLinear);
 		function void(RaylibBeef.Vector2 _p1, RaylibBeef.Vector2 _p2, RaylibBeef.Vector2 _p3, RaylibBeef.Vector2 _p4, float _thick, RaylibBeef.Color _color) DrawSplineSegmentBasis = => RaylibBeef.Raylib.DrawSplineSegmentBasis;
-		compiler.AddSymbol("DrawSplineSegmentBasis", DrawSplineSegmentBasis);
+		symbols.AddSymbol("DrawSplineSegmentBasis", DrawSplineSegmentBasis);
 		function void(RaylibBeef.Vector2 _p1, RaylibBeef.Vector2 _p2, RaylibBeef.Vector2 _p3, RaylibBeef.Vector2 _p4, float _thick, RaylibBeef.Color _color) DrawSplineSegmentCatmullRom = => RaylibBeef.Raylib.DrawSplineSegmentCatmullRom;
-		compiler.AddSymbol("DrawSplineSegmentCatmullRom", DrawSplineSegmentCatmullRom);
+		symbols.AddSymbol("DrawSplineSegmentCatmullRom", DrawSplineSegmentCatmullRom);
 		function void(RaylibBeef.Vector2 _p1, RaylibBeef.Vector2 _c2, RaylibBeef.Vector2 _p3, float _thick, RaylibBeef.Color _color) DrawSplineSegmentBezierQuadratic = => RaylibBeef.Raylib.DrawSplineSegmentBezierQuadratic;
-		compiler.AddSymbol("DrawSplineSegmentBezierQuadratic", DrawSplineSegmentBezierQuadratic);
+		symbols.AddSymbol("DrawSplineSegmentBezierQuadratic", DrawSplineSegmentBezierQuadratic);
 		function void(RaylibBeef.Vector2 _p1, RaylibBeef.Vector2 _c2, RaylibBeef.Vector2 _c3, RaylibBeef.Vector2 _p4, float _thick, RaylibBeef.Color _color) DrawSplineSegmentBezierCubic = => RaylibBeef.Raylib.DrawSplineSegmentBezierCubic;
-		compiler.AddSymbol("DrawSplineSegmentBezierCubic", DrawSplineSegmentBezierCubic);
+		symbols.AddSymbol("DrawSplineSegmentBezierCubic", DrawSplineSegmentBezierCubic);
 		function RaylibBeef.Vector2(RaylibBeef.Vector2 _startPos, RaylibBeef.Vector2 _endPos, float _t) GetSplinePointLinear = => RaylibBeef.Raylib.GetSplinePointLinear;
-		compiler.AddSymbol("GetSplinePointLinear", GetSplinePointLinear);
+		symbols.AddSymbol("GetSplinePointLinear", GetSplinePointLinear);
 		function RaylibBeef.Vector2(RaylibBeef.Vector2 _p1, RaylibBeef.Vector2 _p2, RaylibBeef.Vector2 _p3, RaylibBeef.Vector2 _p4, float _t) GetSplinePointBasis = => RaylibBeef.Raylib.GetSplinePointBasis;
-		compiler.AddSymbol("GetSplinePointBasis", GetSplinePointBasis);
+		symbols.AddSymbol("GetSplinePointBasis", GetSplinePointBasis);
 		function RaylibBeef.Vector2(RaylibBeef.Vector2 _p1, RaylibBeef.Vector2 _p2, RaylibBeef.Vector2 _p3, RaylibBeef.Vector2 _p4, float _t) GetSplinePointCatmullRom = => RaylibBeef.Raylib.GetSplinePointCatmullRom;
-		compiler.AddSymbol("GetSplinePointCatmullRom", GetSplinePointCatmullRom);
+		symbols.AddSymbol("GetSplinePointCatmullRom", GetSplinePointCatmullRom);
 		function RaylibBeef.Vector2(RaylibBeef.Vector2 _p1, RaylibBeef.Vector2 _c2, RaylibBeef.Vector2 _p3, float _t) GetSplinePointBezierQuad = => RaylibBeef.Raylib.GetSplinePointBezierQuad;
-		compiler.AddSymbol("GetSplinePointBezierQuad", GetSplinePointBezierQuad);
+		symbols.AddSymbol("GetSplinePointBezierQuad", GetSplinePointBezierQuad);
 		function RaylibBeef.Vector2(RaylibBeef.Vector2 _p1, RaylibBeef.Vector2 _c2, RaylibBeef.Vector2 _c3, RaylibBeef.Vector2 _p4, float _t) GetSplinePointBezierCubic = => RaylibBeef.Raylib.GetSplinePointBezierCubic;
-		compiler.AddSymbol("GetSplinePointBezierCubic", GetSplinePointBezierCubic);
+		symbols.AddSymbol("GetSplinePointBezierCubic", GetSplinePointBezierCubic);
 		function bool(RaylibBeef.Rectangle _rec1, RaylibBeef.Rectangle _rec2) CheckCollisionRecs = => RaylibBeef.Raylib.CheckCollisionRecs;
-		compiler.AddSymbol("CheckCollisionRecs", CheckCollisionRecs);
+		symbols.AddSymbol("CheckCollisionRecs", CheckCollisionRecs);
 		function bool(RaylibBeef.Vector2 _center1, float _radius1, RaylibBeef.Vector2 _center2, float _radius2) CheckCollisionCircles = => RaylibBeef.Raylib.CheckCollisionCircles;
-		compiler.AddSymbol("CheckCollisionCircles", CheckCollisionCircles);
+		symbols.AddSymbol("CheckCollisionCircles", CheckCollisionCircles);
 		function bool(RaylibBeef.Vector2 _center, float _radius, RaylibBeef.Rectangle _rec) CheckCollisionCircleRec = => RaylibBeef.Raylib.CheckCollisionCircleRec;
-		compiler.AddSymbol("CheckCollisionCircleRec", CheckCollisionCircleRec);
+		symbols.AddSymbol("CheckCollisionCircleRec", CheckCollisionCircleRec);
 		function bool(RaylibBeef.Vector2 _center, float _radius, RaylibBeef.Vector2 _p1, RaylibBeef.Vector2 _p2) CheckCollisionCircleLine = => RaylibBeef.Raylib.CheckCollisionCircleLine;
-		compiler.AddSymbol("CheckCollisionCircleLine", CheckCollisionCircleLine);
+		symbols.AddSymbol("CheckCollisionCircleLine", CheckCollisionCircleLine);
 		function bool(RaylibBeef.Vector2 _point, RaylibBeef.Rectangle _rec) CheckCollisionPointRec = => RaylibBeef.Raylib.CheckCollisionPointRec;
-		compiler.AddSymbol("CheckCollisionPointRec", CheckCollisionPointRec);
+		symbols.AddSymbol("CheckCollisionPointRec", CheckCollisionPointRec);
 		function bool(RaylibBeef.Vector2 _point, RaylibBeef.Vector2 _center, float _radius) CheckCollisionPointCircle = => RaylibBeef.Raylib.CheckCollisionPointCircle;
-		compiler.AddSymbol("CheckCollisionPointCircle", CheckCollisionPointCircle);
+		symbols.AddSymbol("CheckCollisionPointCircle", CheckCollisionPointCircle);
 		function bool(RaylibBeef.Vector2 _point, RaylibBeef.Vector2 _p1, RaylibBeef.Vector2 _p2, RaylibBeef.Vector2 _p3) CheckCollisionPointTriangle = => RaylibBeef.Raylib.CheckCollisionPointTriangle;
-		compiler.AddSymbol("CheckCollisionPointTriangle", CheckCollisionPointTriangle);
+		symbols.AddSymbol("CheckCollisionPointTriangle", CheckCollisionPointTriangle);
 		function bool(RaylibBeef.Vector2 _point, RaylibBeef.Vector2 _p1, RaylibBeef.Vector2 _p2, int32 _threshold) CheckCollisionPointLine = => RaylibBeef.Raylib.CheckCollisionPointLine;
-		compiler.AddSymbol("CheckCollisionPointLine", CheckCollisionPointLine);
+		symbols.AddSymbol("CheckCollisionPointLine", CheckCollisionPointLine);
 		function bool(RaylibBeef.Vector2 _point, RaylibBeef.Vector2* _points, int32 _pointCount) CheckCollisionPointPoly = => RaylibBeef.Raylib.CheckCollisionPointPoly;
-		compiler.AddSymbol("CheckCollisionPointPoly", CheckCollisionPointPoly);
+		symbols.AddSymbol("CheckCollisionPointPoly", CheckCollisionPointPoly);
 		function bool(RaylibBeef.Vector2 _startPos1, RaylibBeef.Vector2 _endPos1, RaylibBeef.Vector2 _startPos2, RaylibBeef.Vector2 _endPos2, RaylibBeef.Vector2* _collisionPoint) CheckCollisionLines = => RaylibBeef.Raylib.CheckCollisionLines;
-		compiler.AddSymbol("CheckCollisionLines", CheckCollisionLines);
+		symbols.AddSymbol("CheckCollisionLines", CheckCollisionLines);
 		function RaylibBeef.Rectangle(RaylibBeef.Rectangle _rec1, RaylibBeef.Rectangle _rec2) GetCollisionRec = => RaylibBeef.Raylib.GetCollisionRec;
-		compiler.AddSymbol("GetCollisionRec", GetCollisionRec);
+		symbols.AddSymbol("GetCollisionRec", GetCollisionRec);
 		function RaylibBeef.Image(RaylibBeef.Texture _texture) LoadImageFromTexture = => RaylibBeef.Raylib.LoadImageFromTexture;
-		compiler.AddSymbol("LoadImageFromTexture", LoadImageFromTexture);
+		symbols.AddSymbol("LoadImageFromTexture", LoadImageFromTexture);
 		function bool(RaylibBeef.Image _image) IsImageValid = => RaylibBeef.Raylib.IsImageValid;
-		compiler.AddSymbol("IsImageValid", IsImageValid);
+		symbols.AddSymbol("IsImageValid", IsImageValid);
 		function void(RaylibBeef.Image _image) UnloadImage = => RaylibBeef.Raylib.UnloadImage;
-		compiler.AddSymbol("UnloadImage", UnloadImage);
+		symbols.AddSymbol("UnloadImage", UnloadImage);
 		function bool(RaylibBeef.Image _image, char8* _fileName) ExportImage = => RaylibBeef.Raylib.ExportImage;
-		compiler.AddSymbol("ExportImage", ExportImage);
+		symbols.AddSymbol("ExportImage", ExportImage);
 		function char8*(RaylibBeef.Image _image, char8* _fileType, int32* _fileSize) ExportImageToMemory = => RaylibBeef.Raylib.ExportImageToMemory;
-		compiler.AddSymbol("ExportImageToMemory", ExportImageToMemory);
+		symbols.AddSymbol("ExportImageToMemory", ExportImageToMemory);
 		function bool(RaylibBeef.Image _image, char8* _fileName) ExportImageAsCode = => RaylibBeef.Raylib.ExportImageAsCode;
-		compiler.AddSymbol("ExportImageAsCode", ExportImageAsCode);
+		symbols.AddSymbol("ExportImageAsCode", ExportImageAsCode);
 		function RaylibBeef.Image(int32 _width, int32 _height, RaylibBeef.Color _color) GenImageColor = => RaylibBeef.Raylib.GenImageColor;
-		compiler.AddSymbol("GenImageColor", GenImageColor);
+		symbols.AddSymbol("GenImageColor", GenImageColor);
 		function RaylibBeef.Image(int32 _width, int32 _height, int32 _direction, RaylibBeef.Color _start, RaylibBeef.Color _end) GenImageGradientLinear = => RaylibBeef.Raylib.GenImageGradientLinear;
-		compiler.AddSymbol("GenImageGradientLinear", GenImageGradientLinear);
+		symbols.AddSymbol("GenImageGradientLinear", GenImageGradientLinear);
 		function RaylibBeef.Image(int32 _width, int32 _height, float _density, RaylibBeef.Color _inner, RaylibBeef.Color _outer) GenImageGradientRadial = => RaylibBeef.Raylib.GenImageGradientRadial;
-		compiler.AddSymbol("GenImageGradientRadial", GenImageGradientRadial);
+		symbols.AddSymbol("GenImageGradientRadial", GenImageGradientRadial);
 		function RaylibBeef.Image(int32 _width, int32 _height, float _density, RaylibBeef.Color _inner, RaylibBeef.Color _outer) GenImageGradientSquare = => RaylibBeef.Raylib.GenImageGradientSquare;
-		compiler.AddSymbol("GenImageGradientSquare", GenImageGradientSquare);
+		symbols.AddSymbol("GenImageGradientSquare", GenImageGradientSquare);
 		function RaylibBeef.Image(int32 _width, int32 _height, int32 _checksX, int32 _checksY, RaylibBeef.Color _col1, RaylibBeef.Color _col2) GenImageChecked = => RaylibBeef.Raylib.GenImageChecked;
-		compiler.AddSymbol("GenImageChecked", GenImageChecked);
+		symbols.AddSymbol("GenImageChecked", GenImageChecked);
 		function RaylibBeef.Image(RaylibBeef.Image _image) ImageCopy = => RaylibBeef.Raylib.ImageCopy;
-		compiler.AddSymbol("ImageCopy", ImageCopy);
+		symbols.AddSymbol("ImageCopy", ImageCopy);
 		function RaylibBeef.Image(RaylibBeef.Image _image, RaylibBeef.Rectangle _rec) ImageFromImage = => RaylibBeef.Raylib.ImageFromImage;
-		compiler.AddSymbol("ImageFromImage", ImageFromImage);
+		symbols.AddSymbol("ImageFromImage", ImageFromImage);
 		function RaylibBeef.Image(RaylibBeef.Image _image, int32 _selectedChannel) ImageFromChannel = => RaylibBeef.Raylib.ImageFromChannel;
-		compiler.AddSymbol("ImageFromChannel", ImageFromChannel);
+		symbols.AddSymbol("ImageFromChannel", ImageFromChannel);
 		function RaylibBeef.Image(char8* _text, int32 _fontSize, RaylibBeef.Color _color) ImageText = => RaylibBeef.Raylib.ImageText;
-		compiler.AddSymbol("ImageText", ImageText);
+		symbols.AddSymbol("ImageText", ImageText);
 		function RaylibBeef.Image(RaylibBeef.Font _font, char8* _text, float _fontSize, float _spacing, RaylibBeef.Color _tint) ImageTextEx = => RaylibBeef.Raylib.ImageTextEx;
-		compiler.AddSymbol("ImageTextEx", ImageTextEx);
+		symbols.AddSymbol("ImageTextEx", ImageTextEx);
 		function void(RaylibBeef.Image* _image, RaylibBeef.Color _fill) ImageToPOT = => RaylibBeef.Raylib.ImageToPOT;
-		compiler.AddSymbol("ImageToPOT", ImageToPOT);
+		symbols.AddSymbol("ImageToPOT", ImageToPOT);
 		function void(RaylibBeef.Image* _image, RaylibBeef.Rectangle _crop) ImageCrop = => RaylibBeef.Raylib.ImageCrop;
-		compiler.AddSymbol("ImageCrop", ImageCrop);
+		symbols.AddSymbol("ImageCrop", ImageCrop);
 		function void(RaylibBeef.Image* _image, RaylibBeef.Color _color, float _threshold) ImageAlphaClear = => RaylibBeef.Raylib.ImageAlphaClear;
-		compiler.AddSymbol("ImageAlphaClear", ImageAlphaClear);
+		symbols.AddSymbol("ImageAlphaClear", ImageAlphaClear);
 		function void(RaylibBeef.Image* _image, RaylibBeef.Image _alphaMask) ImageAlphaMask = => RaylibBeef.Raylib.ImageAlphaMask;
-		compiler.AddSymbol("ImageAlphaMask", ImageAlphaMask);
+		symbols.AddSymbol("ImageAlphaMask", ImageAlphaMask);
 		function void(RaylibBeef.Image* _image, int32 _newWidth, int32 _newHeight, int32 _offsetX, int32 _offsetY, RaylibBeef.Color _fill) ImageResizeCanvas = => RaylibBeef.Raylib.ImageResizeCanvas;
-		compiler.AddSymbol("ImageResizeCanvas", ImageResizeCanvas);
+		symbols.AddSymbol("ImageResizeCanvas", ImageResizeCanvas);
 		function void(RaylibBeef.Image* _image, RaylibBeef.Color _color) ImageColorTint = => RaylibBeef.Raylib.ImageColorTint;
-		compiler.AddSymbol("ImageColorTint", ImageColorTint);
+		symbols.AddSymbol("ImageColorTint", ImageColorTint);
 		function void(RaylibBeef.Image* _image, RaylibBeef.Color _color, RaylibBeef.Color _replace) ImageColorReplace = => RaylibBeef.Raylib.ImageColorReplace;
-		compiler.AddSymbol("ImageColorReplace", ImageColorReplace);
+		symbols.AddSymbol("ImageColorReplace", ImageColorReplace);
 		function RaylibBeef.Color*(RaylibBeef.Image _image) LoadImageColors = => RaylibBeef.Raylib.LoadImageColors;
-		compiler.AddSymbol("LoadImageColors", LoadImageColors);
+		symbols.AddSymbol("LoadImageColors", LoadImageColors);
 		function RaylibBeef.Color*(RaylibBeef.Image _image, int32 _maxPaletteSize, int32* _colorCount) LoadImagePalette = => RaylibBeef.Raylib.LoadImagePalette;
-		compiler.AddSymbol("LoadImagePalette", LoadImagePalette);
+		symbols.AddSymbol("LoadImagePalette", LoadImagePalette);
 		function RaylibBeef.Rectangle(RaylibBeef.Image _image, float _threshold) GetImageAlphaBorder = => RaylibBeef.Raylib.GetImageAlphaBorder;
-		compiler.AddSymbol("GetImageAlphaBorder", GetImageAlphaBorder);
+		symbols.AddSymbol("GetImageAlphaBorder", GetImageAlphaBorder);
 		function RaylibBeef.Color(RaylibBeef.Image _image, int32 _x, int32 _y) GetImageColor = => RaylibBeef.Raylib.GetImageColor;
-		compiler.AddSymbol("GetImageColor", GetImageColor);
+		symbols.AddSymbol("GetImageColor", GetImageColor);
 		function void(RaylibBeef.Image* _dst, RaylibBeef.Color _color) ImageClearBackground = => RaylibBeef.Raylib.ImageClearBackground;
-		compiler.AddSymbol("ImageClearBackground", ImageClearBackground);
+		symbols.AddSymbol("ImageClearBackground", ImageClearBackground);
 		function void(RaylibBeef.Image* _dst, int32 _posX, int32 _posY, RaylibBeef.Color _color) ImageDrawPixel = => RaylibBeef.Raylib.ImageDrawPixel;
-		compiler.AddSymbol("ImageDrawPixel", ImageDrawPixel);
+		symbols.AddSymbol("ImageDrawPixel", ImageDrawPixel);
 		function void(RaylibBeef.Image* _dst, RaylibBeef.Vector2 _position, RaylibBeef.Color _color) ImageDrawPixelV = => RaylibBeef.Raylib.ImageDrawPixelV;
-		compiler.AddSymbol("ImageDrawPixelV", ImageDrawPixelV);
+		symbols.AddSymbol("ImageDrawPixelV", ImageDrawPixelV);
 		function void(RaylibBeef.Image* _dst, int32 _startPosX, int32 _startPosY, int32 _endPosX, int32 _endPosY, RaylibBeef.Color _color) ImageDrawLine = => RaylibBeef.Raylib.ImageDrawLine;
-		compiler.AddSymbol("ImageDrawLine", ImageDrawLine);
+		symbols.AddSymbol("ImageDrawLine", ImageDrawLine);
 		function void(RaylibBeef.Image* _dst, RaylibBeef.Vector2 _start, RaylibBeef.Vector2 _end, RaylibBeef.Color _color) ImageDrawLineV = => RaylibBeef.Raylib.ImageDrawLineV;
-		compiler.AddSymbol("ImageDrawLineV", ImageDrawLineV);
+		symbols.AddSymbol("ImageDrawLineV", ImageDrawLineV);
 		function void(RaylibBeef.Image* _dst, RaylibBeef.Vector2 _start, RaylibBeef.Vector2 _end, int32 _thick, RaylibBeef.Color _color) ImageDrawLineEx = => RaylibBeef.Raylib.ImageDrawLineEx;
-		compiler.AddSymbol("ImageDrawLineEx", ImageDrawLineEx);
+		symbols.AddSymbol("ImageDrawLineEx", ImageDrawLineEx);
 		function void(RaylibBeef.Image* _dst, int32 _centerX, int32 _centerY, int32 _radius, RaylibBeef.Color _color) ImageDrawCircle = => RaylibBeef.Raylib.ImageDrawCircle;
-		compiler.AddSymbol("ImageDrawCircle", ImageDrawCircle);
+		symbols.AddSymbol("ImageDrawCircle", ImageDrawCircle);
 		function void(RaylibBeef.Image* _dst, RaylibBeef.Vector2 _center, int32 _radius, RaylibBeef.Color _color) ImageDrawCircleV = => RaylibBeef.Raylib.ImageDrawCircleV;
-		compiler.AddSymbol("ImageDrawCircleV", ImageDrawCircleV);
+		symbols.AddSymbol("ImageDrawCircleV", ImageDrawCircleV);
 		function void(RaylibBeef.Image* _dst, int32 _centerX, int32 _centerY, int32 _radius, RaylibBeef.Color _color) ImageDrawCircleLines = => RaylibBeef.Raylib.ImageDrawCircleLines;
-		compiler.AddSymbol("ImageDrawCircleLines", ImageDrawCircleLines);
+		symbols.AddSymbol("ImageDrawCircleLines", ImageDrawCircleLines);
 		function void(RaylibBeef.Image* _dst, RaylibBeef.Vector2 _center, int32 _radius, RaylibBeef.Color _color) ImageDrawCircleLinesV = => RaylibBeef.Raylib.ImageDrawCircleLinesV;
-		compiler.AddSymbol("ImageDrawCircleLinesV", ImageDrawCircleLinesV);
+		symbols.AddSymbol("ImageDrawCircleLinesV", ImageDrawCircleLinesV);
 		function void(RaylibBeef.Image* _dst, int32 _posX, int32 _posY, int32 _width, int32 _height, RaylibBeef.Color _color) ImageDrawRectangle = => RaylibBeef.Raylib.ImageDrawRectangle;
-		compiler.AddSymbol("ImageDrawRectangle", ImageDrawRectangle);
+		symbols.AddSymbol("ImageDrawRectangle", ImageDrawRectangle);
 		function void(RaylibBeef.Image* _dst, RaylibBeef.Vector2 _position, RaylibBeef.Vector2 _size, RaylibBeef.Color _color) ImageDrawRectangleV = => RaylibBeef.Raylib.ImageDrawRectangleV;
-		compiler.AddSymbol("ImageDrawRectangleV", ImageDrawRectangleV);
+		symbols.AddSymbol("ImageDrawRectangleV", ImageDrawRectangleV);
 		function void(RaylibBeef.Image* _dst, RaylibBeef.Rectangle _rec, RaylibBeef.Color _color) ImageDrawRectangleRec = => RaylibBeef.Raylib.ImageDrawRectangleRec;
-		compiler.AddSymbol("ImageDrawRectangleRec", ImageDrawRectangleRec);
+		symbols.AddSymbol("ImageDrawRectangleRec", ImageDrawRectangleRec);
 		function void(RaylibBeef.Image* _dst, RaylibBeef.Rectangle _rec, int32 _thick, RaylibBeef.Color _color) ImageDrawRectangleLines = => RaylibBeef.Raylib.ImageDrawRectangleLines;
-		compiler.AddSymbol("ImageDrawRectangleLines", ImageDrawRectangleLines);
+		symbols.AddSymbol("ImageDrawRectangleLines", ImageDrawRectangleLines);
 		function void(RaylibBeef.Image* _dst, RaylibBeef.Vector2 _v1, RaylibBeef.Vector2 _v2, RaylibBeef.Vector2 _v3, RaylibBeef.Color _color) ImageDrawTriangle = => RaylibBeef.Raylib.ImageDrawTriangle;
-		compiler.AddSymbol("ImageDrawTriangle", ImageDrawTriangle);
+		symbols.AddSymbol("ImageDrawTriangle", ImageDrawTriangle);
 		function void(RaylibBeef.Image* _dst, RaylibBeef.Vector2 _v1, RaylibBeef.Vector2 _v2, RaylibBeef.Vector2 _v3, RaylibBeef.Color _c1, RaylibBeef.Color _c2, RaylibBeef.Color _c3) ImageDrawTriangleEx = => RaylibBeef.Raylib.ImageDrawTriangleEx;
-		compiler.AddSymbol("ImageDrawTriangleEx", ImageDrawTriangleEx);
+		symbols.AddSymbol("ImageDrawTriangleEx", ImageDrawTriangleEx);
 		function void(RaylibBeef.Image* _dst, RaylibBeef.Vector2 _v1, RaylibBeef.Vector2 _v2, RaylibBeef.Vector2 _v3, RaylibBeef.Color _color) ImageDrawTriangleLines = => RaylibBeef.Raylib.ImageDrawTriangleLines;
-		compiler.AddSymbol("ImageDrawTriangleLines", ImageDrawTriangleLines);
+		symbols.AddSymbol("ImageDrawTriangleLines", ImageDrawTriangleLines);
 		function void(RaylibBeef.Image* _dst, RaylibBeef.Vector2* _points, int32 _pointCount, RaylibBeef.Color _color) ImageDrawTriangleFan = => RaylibBeef.Raylib.ImageDrawTriangleFan;
-		compiler.AddSymbol("ImageDrawTriangleFan", ImageDrawTriangleFan);
+		symbols.AddSymbol("ImageDrawTriangleFan", ImageDrawTriangleFan);
 		function void(RaylibBeef.Image* _dst, RaylibBeef.Vector2* _points, int32 _pointCount, RaylibBeef.Color _color) ImageDrawTriangleStrip = => RaylibBeef.Raylib.ImageDrawTriangleStrip;
-		compiler.AddSymbol("ImageDrawTriangleStrip", ImageDrawTriangleStrip);
+		symbols.AddSymbol("ImageDrawTriangleStrip", ImageDrawTriangleStrip);
 		function void(RaylibBeef.Image* _dst, RaylibBeef.Image _src, RaylibBeef.Rectangle _srcRec, RaylibBeef.Rectangle _dstRec, RaylibBeef.Color _tint) ImageDraw = => RaylibBeef.Raylib.ImageDraw;
-		compiler.AddSymbol("ImageDraw", ImageDraw);
+		symbols.AddSymbol("ImageDraw", ImageDraw);
 		function void(RaylibBeef.Image* _dst, char8* _text, int32 _posX, int32 _posY, int32 _fontSize, RaylibBeef.Color _color) ImageDrawText = => RaylibBeef.Raylib.ImageDrawText;
-		compiler.AddSymbol("ImageDrawText", ImageDrawText);
+		symbols.AddSymbol("ImageDrawText", ImageDrawText);
 		function void(RaylibBeef.Image* _dst, RaylibBeef.Font _font, char8* _text, RaylibBeef.Vector2 _position, float _fontSize, float _spacing, RaylibBeef.Color _tint) ImageDrawTextEx = => RaylibBeef.Raylib.ImageDrawTextEx;
-		compiler.AddSymbol("ImageDrawTextEx", ImageDrawTextEx);
+		symbols.AddSymbol("ImageDrawTextEx", ImageDrawTextEx);
 		function RaylibBeef.Texture(RaylibBeef.Image _image) LoadTextureFromImage = => RaylibBeef.Raylib.LoadTextureFromImage;
-		compiler.AddSymbol("LoadTextureFromImage", LoadTextureFromImage);
+		symbols.AddSymbol("LoadTextureFromImage", LoadTextureFromImage);
 		function RaylibBeef.Texture(RaylibBeef.Image _image, int32 _layout) LoadTextureCubemap = => RaylibBeef.Raylib.LoadTextureCubemap;
-		compiler.AddSymbol("LoadTextureCubemap", LoadTextureCubemap);
+		symbols.AddSymbol("LoadTextureCubemap", LoadTextureCubemap);
 		function bool(RaylibBeef.Texture _texture) IsTextureValid = => RaylibBeef.Raylib.IsTextureValid;
-		compiler.AddSymbol("IsTextureValid", IsTextureValid);
+		symbols.AddSymbol("IsTextureValid", IsTextureValid);
 		function void(RaylibBeef.Texture _texture) UnloadTexture = => RaylibBeef.Raylib.UnloadTexture;
-		compiler.AddSymbol("UnloadTexture", UnloadTexture);
+		symbols.AddSymbol("UnloadTexture", UnloadTexture);
 		function bool(RaylibBeef.RenderTexture _target) IsRenderTextureValid = => RaylibBeef.Raylib.IsRenderTextureValid;
-		compiler.AddSymbol("IsRenderTextureValid", IsRenderTextureValid);
+		symbols.AddSymbol("IsRenderTextureValid", IsRenderTextureValid);
 		function void(RaylibBeef.RenderTexture _target) UnloadRenderTexture = => RaylibBeef.Raylib.UnloadRenderTexture;
-		compiler.AddSymbol("UnloadRenderTexture", UnloadRenderTexture);
+		symbols.AddSymbol("UnloadRenderTexture", UnloadRenderTexture);
 		function void(RaylibBeef.Texture _texture, void* _pixels) UpdateTexture = => RaylibBeef.Raylib.UpdateTexture;
-		compiler.AddSymbol("UpdateTexture", UpdateTexture);
+		symbols.AddSymbol("UpdateTexture", UpdateTexture);
 		function void(RaylibBeef.Texture _texture, RaylibBeef.Rectangle _rec, void* _pixels) UpdateTextureRec = => RaylibBeef.Raylib.UpdateTextureRec;
-		compiler.AddSymbol("UpdateTextureRec", UpdateTextureRec);
+		symbols.AddSymbol("UpdateTextureRec", UpdateTextureRec);
 		function void(RaylibBeef.Texture _texture, int32 _filter) SetTextureFilter = => RaylibBeef.Raylib.SetTextureFilter;
-		compiler.AddSymbol("SetTextureFilter", SetTextureFilter);
+		symbols.AddSymbol("SetTextureFilter", SetTextureFilter);
 		function void(RaylibBeef.Texture _texture, int32 _wrap) SetTextureWrap = => RaylibBeef.Raylib.SetTextureWrap;
-		compiler.AddSymbol("SetTextureWrap", SetTextureWrap);
+		symbols.AddSymbol("SetTextureWrap", SetTextureWrap);
 		function void(RaylibBeef.Texture _texture, int32 _posX, int32 _posY, RaylibBeef.Color _tint) DrawTexture = => RaylibBeef.Raylib.DrawTexture;
-		compiler.AddSymbol("DrawTexture", DrawTexture);
+		symbols.AddSymbol("DrawTexture", DrawTexture);
 		function void(RaylibBeef.Texture _texture, RaylibBeef.Vector2 _position, RaylibBeef.Color _tint) DrawTextureV = => RaylibBeef.Raylib.DrawTextureV;
-		compiler.AddSymbol("DrawTextureV", DrawTextureV);
+		symbols.AddSymbol("DrawTextureV", DrawTextureV);
 		function void(RaylibBeef.Texture _texture, RaylibBeef.Vector2 _position, float _rotation, float _scale, RaylibBeef.Color _tint) DrawTextureEx = => RaylibBeef.Raylib.DrawTextureEx;
-		compiler.AddSymbol("DrawTextureEx", DrawTextureEx);
+		symbols.AddSymbol("DrawTextureEx", DrawTextureEx);
 		function void(RaylibBeef.Texture _texture, RaylibBeef.Rectangle _source, RaylibBeef.Vector2 _position, RaylibBeef.Color _tint) DrawTextureRec = => RaylibBeef.Raylib.DrawTextureRec;
-		compiler.AddSymbol("DrawTextureRec", DrawTextureRec);
+		symbols.AddSymbol("DrawTextureRec", DrawTextureRec);
 		function void(RaylibBeef.Texture _texture, RaylibBeef.Rectangle _source, RaylibBeef.Rectangle _dest, RaylibBeef.Vector2 _origin, float _rotation, RaylibBeef.Color _tint) DrawTexturePro = => RaylibBeef.Raylib.DrawTexturePro;
-		compiler.AddSymbol("DrawTexturePro", DrawTexturePro);
+		symbols.AddSymbol("DrawTexturePro", DrawTexturePro);
 		function void(RaylibBeef.Texture _texture, RaylibBeef.NPatchInfo _nPatchInfo, RaylibBeef.Rectangle _dest, RaylibBeef.Vector2 _origin, float _rotation, RaylibBeef.Color _tint) DrawTextureNPatch = => RaylibBeef.Raylib.DrawTextureNPatch;
-		compiler.AddSymbol("DrawTextureNPatch", DrawTextureNPatch);
+		symbols.AddSymbol("DrawTextureNPatch", DrawTextureNPatch);
 		function bool(RaylibBeef.Color _col1, RaylibBeef.Color _col2) ColorIsEqual = => RaylibBeef.Raylib.ColorIsEqual;
-		compiler.AddSymbol("ColorIsEqual", ColorIsEqual);
+		symbols.AddSymbol("ColorIsEqual", ColorIsEqual);
 		function RaylibBeef.Color(RaylibBeef.Color _color, float _alpha) Fade = => RaylibBeef.Raylib.Fade;
-		compiler.AddSymbol("Fade", Fade);
+		symbols.AddSymbol("Fade", Fade);
 		function int32(RaylibBeef.Color _color) ColorToInt = => RaylibBeef.Raylib.ColorToInt;
-		compiler.AddSymbol("ColorToInt", ColorToInt);
+		symbols.AddSymbol("ColorToInt", ColorToInt);
 		function RaylibBeef.Vector4(RaylibBeef.Color _color) ColorNormalize = => RaylibBeef.Raylib.ColorNormalize;
-		compiler.AddSymbol("ColorNormalize", ColorNormalize);
+		symbols.AddSymbol("ColorNormalize", ColorNormalize);
 		function RaylibBeef.Color(RaylibBeef.Vector4 _normalized) ColorFromNormalized = => RaylibBeef.Raylib.ColorFromNormalized;
-		compiler.AddSymbol("ColorFromNormalized", ColorFromNormalized);
+		symbols.AddSymbol("ColorFromNormalized", ColorFromNormalized);
 		function RaylibBeef.Vector3(RaylibBeef.Color _color) ColorToHSV = => RaylibBeef.Raylib.ColorToHSV;
-		compiler.AddSymbol("ColorToHSV", ColorToHSV);
+		symbols.AddSymbol("ColorToHSV", ColorToHSV);
 		function RaylibBeef.Color(RaylibBeef.Color _color, RaylibBeef.Color _tint) ColorTint = => RaylibBeef.Raylib.ColorTint;
-		compiler.AddSymbol("ColorTint", ColorTint);
+		symbols.AddSymbol("ColorTint", ColorTint);
 		function RaylibBeef.Color(RaylibBeef.Color _color, float _factor) ColorBrightness = => RaylibBeef.Raylib.ColorBrightness;
-		compiler.AddSymbol("ColorBrightness", ColorBrightness);
+		symbols.AddSymbol("ColorBrightness", ColorBrightness);
 		function RaylibBeef.Color(RaylibBeef.Color _color, float _contrast) ColorContrast = => RaylibBeef.Raylib.ColorContrast;
-		compiler.AddSymbol("ColorContrast", ColorContrast);
+		symbols.AddSymbol("ColorContrast", ColorContrast);
 		function RaylibBeef.Color(RaylibBeef.Color _color, float _alpha) ColorAlpha = => RaylibBeef.Raylib.ColorAlpha;
-		compiler.AddSymbol("ColorAlpha", ColorAlpha);
+		symbols.AddSymbol("ColorAlpha", ColorAlpha);
 		function RaylibBeef.Color(RaylibBeef.Color _dst, RaylibBeef.Color _src, RaylibBeef.Color _tint) ColorAlphaBlend = => RaylibBeef.Raylib.ColorAlphaBlend;
-		compiler.AddSymbol("ColorAlphaBlend", ColorAlphaBlend);
+		symbols.AddSymbol("ColorAlphaBlend", ColorAlphaBlend);
 		function RaylibBeef.Color(RaylibBeef.Color _color1, RaylibBeef.Color _color2, float _factor) ColorLerp = => RaylibBeef.Raylib.ColorLerp;
-		compiler.AddSymbol("ColorLerp", ColorLerp);
+		symbols.AddSymbol("ColorLerp", ColorLerp);
 		function void(void* _dstPtr, RaylibBeef.Color _color, int32 _format) SetPixelColor = => RaylibBeef.Raylib.SetPixelColor;
-		compiler.AddSymbol("SetPixelColor", SetPixelColor);
+		symbols.AddSymbol("SetPixelColor", SetPixelColor);
 		function RaylibBeef.Font(RaylibBeef.Image _image, RaylibBeef.Color _key, int32 _firstChar) LoadFontFromImage = => RaylibBeef.Raylib.LoadFontFromImage;
-		compiler.AddSymbol("LoadFontFromImage", LoadFontFromImage);
+		symbols.AddSymbol("LoadFontFromImage", LoadFontFromImage);
 		function bool(RaylibBeef.Font _font) IsFontValid = => RaylibBeef.Raylib.IsFontValid;
-		compiler.AddSymbol("IsFontValid", IsFontValid);
+		symbols.AddSymbol("IsFontValid", IsFontValid);
 		function void(RaylibBeef.Font _font) UnloadFont = => RaylibBeef.Raylib.UnloadFont;
-		compiler.AddSymbol("UnloadFont", UnloadFont);
+		symbols.AddSymbol("UnloadFont", UnloadFont);
 		function bool(RaylibBeef.Font _font, char8* _fileName) ExportFontAsCode = => RaylibBeef.Raylib.ExportFontAsCode;
-		compiler.AddSymbol("ExportFontAsCode", ExportFontAsCode);
+		symbols.AddSymbol("ExportFontAsCode", ExportFontAsCode);
 		function void(char8* _text, int32 _posX, int32 _posY, int32 _fontSize, RaylibBeef.Color _color) DrawText = => RaylibBeef.Raylib.DrawText;
-		compiler.AddSymbol("DrawText", DrawText);
+		symbols.AddSymbol("DrawText", DrawText);
 		function void(RaylibBeef.Font _font, char8* _text, RaylibBeef.Vector2 _position, float _fontSize, float _spacing, RaylibBeef.Color _tint) DrawTextEx = => RaylibBeef.Raylib.DrawTextEx;
-		compiler.AddSymbol("DrawTextEx", DrawTextEx);
+		symbols.AddSymbol("DrawTextEx", DrawTextEx);
 		function void(RaylibBeef.Font _font, char8* _text, RaylibBeef.Vector2 _position, RaylibBeef.Vector2 _origin, float _rotation, float _fontSize, float _spacing, RaylibBeef.Color _tint) DrawTextPro = => RaylibBeef.Raylib.DrawTextPro;
-		compiler.AddSymbol("DrawTextPro", DrawTextPro);
+		symbols.AddSymbol("DrawTextPro", DrawTextPro);
 		function void(RaylibBeef.Font _font, int32 _codepoint, RaylibBeef.Vector2 _position, float _fontSize, RaylibBeef.Color _tint) DrawTextCodepoint = => RaylibBeef.Raylib.DrawTextCodepoint;
-		compiler.AddSymbol("DrawTextCodepoint", DrawTextCodepoint);
+		symbols.AddSymbol("DrawTextCodepoint", DrawTextCodepoint);
 		function void(RaylibBeef.Font _font, int32* _codepoints, int32 _codepointCount, RaylibBeef.Vector2 _position, float _fontSize, float _spacing, RaylibBeef.Color _tint) DrawTextCodepoints = => RaylibBeef.Raylib.DrawTextCodepoints;
-		compiler.AddSymbol("DrawTextCodepoints", DrawTextCodepoints);
+		symbols.AddSymbol("DrawTextCodepoints", DrawTextCodepoints);
 		function RaylibBeef.Vector2(RaylibBeef.Font _font, char8* _text, float _fontSize, float _spacing) MeasureTextEx = => RaylibBeef.Raylib.MeasureTextEx;
-		compiler.AddSymbol("MeasureTextEx", MeasureTextEx);
+		symbols.AddSymbol("MeasureTextEx", MeasureTextEx);
 		function int32(RaylibBeef.Font _font, int32 _codepoint) GetGlyphIndex = => RaylibBeef.Raylib.GetGlyphIndex;
-		compiler.AddSymbol("GetGlyphIndex", GetGlyphIndex);
+		symbols.AddSymbol("GetGlyphIndex", GetGlyphIndex);
 		function RaylibBeef.GlyphInfo(RaylibBeef.Font _font, int32 _codepoint) GetGlyphInfo = => RaylibBeef.Raylib.GetGlyphInfo;
-		compiler.AddSymbol("GetGlyphInfo", GetGlyphInfo);
+		symbols.AddSymbol("GetGlyphInfo", GetGlyphInfo);
 		function RaylibBeef.Rectangle(RaylibBeef.Font _font, int32 _codepoint) GetGlyphAtlasRec = => RaylibBeef.Raylib.GetGlyphAtlasRec;
-		compiler.AddSymbol("GetGlyphAtlasRec", GetGlyphAtlasRec);
+		symbols.AddSymbol("GetGlyphAtlasRec", GetGlyphAtlasRec);
 		function void(RaylibBeef.Vector3 _startPos, RaylibBeef.Vector3 _endPos, RaylibBeef.Color _color) DrawLine3D = => RaylibBeef.Raylib.DrawLine3D;
-		compiler.AddSymbol("DrawLine3D", DrawLine3D);
+		symbols.AddSymbol("DrawLine3D", DrawLine3D);
 		function void(RaylibBeef.Vector3 _position, RaylibBeef.Color _color) DrawPoint3D = => RaylibBeef.Raylib.DrawPoint3D;
-		compiler.AddSymbol("DrawPoint3D", DrawPoint3D);
+		symbols.AddSymbol("DrawPoint3D", DrawPoint3D);
 		function void(RaylibBeef.Vector3 _center, float _radius, RaylibBeef.Vector3 _rotationAxis, float _rotationAngle, RaylibBeef.Color _color) DrawCircle3D = => RaylibBeef.Raylib.DrawCircle3D;
-		compiler.AddSymbol("DrawCircle3D", DrawCircle3D);
+		symbols.AddSymbol("DrawCircle3D", DrawCircle3D);
 		function void(RaylibBeef.Vector3 _v1, RaylibBeef.Vector3 _v2, RaylibBeef.Vector3 _v3, RaylibBeef.Color _color) DrawTriangle3D = => RaylibBeef.Raylib.DrawTriangle3D;
-		compiler.AddSymbol("DrawTriangle3D", DrawTriangle3D);
+		symbols.AddSymbol("DrawTriangle3D", DrawTriangle3D);
 		function void(RaylibBeef.Vector3* _points, int32 _pointCount, RaylibBeef.Color _color) DrawTriangleStrip3D = => RaylibBeef.Raylib.DrawTriangleStrip3D;
-		compiler.AddSymbol("DrawTriangleStrip3D", DrawTriangleStrip3D);
+		symbols.AddSymbol("DrawTriangleStrip3D", DrawTriangleStrip3D);
 		function void(RaylibBeef.Vector3 _position, float _width, float _height, float _length, RaylibBeef.Color _color) DrawCube = => RaylibBeef.Raylib.DrawCube;
-		compiler.AddSymbol("DrawCube", DrawCube);
+		symbols.AddSymbol("DrawCube", DrawCube);
 		function void(RaylibBeef.Vector3 _position, RaylibBeef.Vector3 _size, RaylibBeef.Color _color) DrawCubeV = => RaylibBeef.Raylib.DrawCubeV;
-		compiler.AddSymbol("DrawCubeV", DrawCubeV);
+		symbols.AddSymbol("DrawCubeV", DrawCubeV);
 		function void(RaylibBeef.Vector3 _position, float _width, float _height, float _length, RaylibBeef.Color _color) DrawCubeWires = => RaylibBeef.Raylib.DrawCubeWires;
-		compiler.AddSymbol("DrawCubeWires", DrawCubeWires);
+		symbols.AddSymbol("DrawCubeWires", DrawCubeWires);
 		function void(RaylibBeef.Vector3 _position, RaylibBeef.Vector3 _size, RaylibBeef.Color _color) DrawCubeWiresV = => RaylibBeef.Raylib.DrawCubeWiresV;
-		compiler.AddSymbol("DrawCubeWiresV", DrawCubeWiresV);
+		symbols.AddSymbol("DrawCubeWiresV", DrawCubeWiresV);
 		function void(RaylibBeef.Vector3 _centerPos, float _radius, RaylibBeef.Color _color) DrawSphere = => RaylibBeef.Raylib.DrawSphere;
-		compiler.AddSymbol("DrawSphere", DrawSphere);
+		symbols.AddSymbol("DrawSphere", DrawSphere);
 		function void(RaylibBeef.Vector3 _centerPos, float _radius, int32 _rings, int32 _slices, RaylibBeef.Color _color) DrawSphereEx = => RaylibBeef.Raylib.DrawSphereEx;
-		compiler.AddSymbol("DrawSphereEx", DrawSphereEx);
+		symbols.AddSymbol("DrawSphereEx", DrawSphereEx);
 		function void(RaylibBeef.Vector3 _centerPos, float _radius, int32 _rings, int32 _slices, RaylibBeef.Color _color) DrawSphereWires = => RaylibBeef.Raylib.DrawSphereWires;
-		compiler.AddSymbol("DrawSphereWires", DrawSphereWires);
+		symbols.AddSymbol("DrawSphereWires", DrawSphereWires);
 		function void(RaylibBeef.Vector3 _position, float _radiusTop, float _radiusBottom, float _height, int32 _slices, RaylibBeef.Color _color) DrawCylinder = => RaylibBeef.Raylib.DrawCylinder;
-		compiler.AddSymbol("DrawCylinder", DrawCylinder);
+		symbols.AddSymbol("DrawCylinder", DrawCylinder);
 		function void(RaylibBeef.Vector3 _startPos, RaylibBeef.Vector3 _endPos, float _startRadius, float _endRadius, int32 _sides, RaylibBeef.Color _color) DrawCylinderEx = => RaylibBeef.Raylib.DrawCylinderEx;
-		compiler.AddSymbol("DrawCylinderEx", DrawCylinderEx);
+		symbols.AddSymbol("DrawCylinderEx", DrawCylinderEx);
 		function void(RaylibBeef.Vector3 _position, float _radiusTop, float _radiusBottom, float _height, int32 _slices, RaylibBeef.Color _color) DrawCylinderWires = => RaylibBeef.Raylib.DrawCylinderWires;
-		compiler.AddSymbol("DrawCylinderWires", DrawCylinderWires);
+		symbols.AddSymbol("DrawCylinderWires", DrawCylinderWires);
 		function void(RaylibBeef.Vector3 _startPos, RaylibBeef.Vector3 _endPos, float _startRadius, float _endRadius, int32 _sides, RaylibBeef.Color _color) DrawCylinderWiresEx = => RaylibBeef.Raylib.DrawCylinderWiresEx;
-		compiler.AddSymbol("DrawCylinderWiresEx", DrawCylinderWiresEx);
+		symbols.AddSymbol("DrawCylinderWiresEx", DrawCylinderWiresEx);
 		function void(RaylibBeef.Vector3 _startPos, RaylibBeef.Vector3 _endPos, float _radius, int32 _slices, int32 _rings, RaylibBeef.Color _color) DrawCapsule = => RaylibBeef.Raylib.DrawCapsule;
-		compiler.AddSymbol("DrawCapsule", DrawCapsule);
+		symbols.AddSymbol("DrawCapsule", DrawCapsule);
 		function void(RaylibBeef.Vector3 _startPos, RaylibBeef.Vector3 _endPos, float _radius, int32 _slices, int32 _rings, RaylibBeef.Color _color) DrawCapsuleWires = => RaylibBeef.Raylib.DrawCapsuleWires;
-		compiler.AddSymbol("DrawCapsuleWires", DrawCapsuleWires);
+		symbols.AddSymbol("DrawCapsuleWires", DrawCapsuleWires);
 		function void(RaylibBeef.Vector3 _centerPos, RaylibBeef.Vector2 _size, RaylibBeef.Color _color) DrawPlane = => RaylibBeef.Raylib.DrawPlane;
-		compiler.AddSymbol("DrawPlane", DrawPlane);
+		symbols.AddSymbol("DrawPlane", DrawPlane);
 		function void(RaylibBeef.Ray _ray, RaylibBeef.Color _color) DrawRay = => RaylibBeef.Raylib.DrawRay;
-		compiler.AddSymbol("DrawRay", DrawRay);
+		symbols.AddSymbol("DrawRay", DrawRay);
 		function RaylibBeef.Model(RaylibBeef.Mesh _mesh) LoadModelFromMesh = => RaylibBeef.Raylib.LoadModelFromMesh;
-		compiler.AddSymbol("LoadModelFromMesh", LoadModelFromMesh);
+		symbols.AddSymbol("LoadModelFromMesh", LoadModelFromMesh);
 		function bool(RaylibBeef.Model _model) IsModelValid = => RaylibBeef.Raylib.IsModelValid;
-		compiler.AddSymbol("IsModelValid", IsModelValid);
+		symbols.AddSymbol("IsModelValid", IsModelValid);
 		function void(RaylibBeef.Model _model) UnloadModel = => RaylibBeef.Raylib.UnloadModel;
-		compiler.AddSymbol("UnloadModel", UnloadModel);
+		symbols.AddSymbol("UnloadModel", UnloadModel);
 		function RaylibBeef.BoundingBox(RaylibBeef.Model _model) GetModelBoundingBox = => RaylibBeef.Raylib.GetModelBoundingBox;
-		compiler.AddSymbol("GetModelBoundingBox", GetModelBoundingBox);
+		symbols.AddSymbol("GetModelBoundingBox", GetModelBoundingBox);
 		function void(RaylibBeef.Model _model, RaylibBeef.Vector3 _position, float _scale, RaylibBeef.Color _tint) DrawModel = => RaylibBeef.Raylib.DrawModel;
-		compiler.AddSymbol("DrawModel", DrawModel);
+		symbols.AddSymbol("DrawModel", DrawModel);
 		function void(RaylibBeef.Model _model, RaylibBeef.Vector3 _position, RaylibBeef.Vector3 _rotationAxis, float _rotationAngle, RaylibBeef.Vector3 _scale, RaylibBeef.Color _tint) DrawModelEx = => RaylibBeef.Raylib.DrawModelEx;
-		compiler.AddSymbol("DrawModelEx", DrawModelEx);
+		symbols.AddSymbol("DrawModelEx", DrawModelEx);
 		function void(RaylibBeef.Model _model, RaylibBeef.Vector3 _position, float _scale, RaylibBeef.Color _tint) DrawModelWires = => RaylibBeef.Raylib.DrawModelWires;
-		compiler.AddSymbol("DrawModelWires", DrawModelWires);
+		symbols.AddSymbol("DrawModelWires", DrawModelWires);
 		function void(RaylibBeef.Model _model, RaylibBeef.Vector3 _position, RaylibBeef.Vector3 _rotationAxis, float _rotationAngle, RaylibBeef.Vector3 _scale, RaylibBeef.Color _tint) DrawModelWiresEx = => RaylibBeef.Raylib.DrawModelWiresEx;
-		compiler.AddSymbol("DrawModelWiresEx", DrawModelWiresEx);
+		symbols.AddSymbol("DrawModelWiresEx", DrawModelWiresEx);
 		function void(RaylibBeef.Model _model, RaylibBeef.Vector3 _position, float _scale, RaylibBeef.Color _tint) DrawModelPoints = => RaylibBeef.Raylib.DrawModelPoints;
-		compiler.AddSymbol("DrawModelPoints", DrawModelPoints);
+		symbols.AddSymbol("DrawModelPoints", DrawModelPoints);
 		function void(RaylibBeef.Model _model, RaylibBeef.Vector3 _position, RaylibBeef.Vector3 _rotationAxis, float _rotationAngle, RaylibBeef.Vector3 _scale, RaylibBeef.Color _tint) DrawModelPointsEx = => RaylibBeef.Raylib.DrawModelPointsEx;
-		compiler.AddSymbol("DrawModelPointsEx", DrawModelPointsEx);
+		symbols.AddSymbol("DrawModelPointsEx", DrawModelPointsEx);
 		function void(RaylibBeef.BoundingBox _box, RaylibBeef.Color _color) DrawBoundingBox = => RaylibBeef.Raylib.DrawBoundingBox;
-		compiler.AddSymbol("DrawBoundingBox", DrawBoundingBox);
+		symbols.AddSymbol("DrawBoundingBox", DrawBoundingBox);
 		function void(RaylibBeef.Camera3D _camera, RaylibBeef.Texture _texture, RaylibBeef.Vector3 _position, float _scale, RaylibBeef.Color _tint) DrawBillboard = => RaylibBeef.Raylib.DrawBillboard;
-		compiler.AddSymbol("DrawBillboard", DrawBillboard);
+		symbols.AddSymbol("DrawBillboard", DrawBillboard);
 		function void(RaylibBeef.Camera3D _camera, RaylibBeef.Texture _texture, RaylibBeef.Rectangle _source, RaylibBeef.Vector3 _position, RaylibBeef.Vector2 _size, RaylibBeef.Color _tint) DrawBillboardRec = => RaylibBeef.Raylib.DrawBillboardRec;
-		compiler.AddSymbol("DrawBillboardRec", DrawBillboardRec);
+		symbols.AddSymbol("DrawBillboardRec", DrawBillboardRec);
 		function void(RaylibBeef.Camera3D _camera, RaylibBeef.Texture _texture, RaylibBeef.Rectangle _source, RaylibBeef.Vector3 _position, RaylibBeef.Vector3 _up, RaylibBeef.Vector2 _size, RaylibBeef.Vector2 _origin, float _rotation, RaylibBeef.Color _tint) DrawBillboardPro = => RaylibBeef.Raylib.DrawBillboardPro;
-		compiler.AddSymbol("DrawBillboardPro", DrawBillboardPro);
+		symbols.AddSymbol("DrawBillboardPro", DrawBillboardPro);
 		function void(RaylibBeef.Mesh _mesh, int32 _index, void* _data, int32 _dataSize, int32 _offset) UpdateMeshBuffer = => RaylibBeef.Raylib.UpdateMeshBuffer;
-		compiler.AddSymbol("UpdateMeshBuffer", UpdateMeshBuffer);
+		symbols.AddSymbol("UpdateMeshBuffer", UpdateMeshBuffer);
 		function void(RaylibBeef.Mesh _mesh) UnloadMesh = => RaylibBeef.Raylib.UnloadMesh;
-		compiler.AddSymbol("UnloadMesh", UnloadMesh);
+		symbols.AddSymbol("UnloadMesh", UnloadMesh);
 		function void(RaylibBeef.Mesh _mesh, RaylibBeef.Material _material, RaylibBeef.Matrix _transform) DrawMesh = => RaylibBeef.Raylib.DrawMesh;
-		compiler.AddSymbol("DrawMesh", DrawMesh);
+		symbols.AddSymbol("DrawMesh", DrawMesh);
 		function void(RaylibBeef.Mesh _mesh, RaylibBeef.Material _material, RaylibBeef.Matrix* _transforms, int32 _instances) DrawMeshInstanced = => RaylibBeef.Raylib.DrawMeshInstanced;
-		compiler.AddSymbol("DrawMeshInstanced", DrawMeshInstanced);
+		symbols.AddSymbol("DrawMeshInstanced", DrawMeshInstanced);
 		function RaylibBeef.BoundingBox(RaylibBeef.Mesh _mesh) GetMeshBoundingBox = => RaylibBeef.Raylib.GetMeshBoundingBox;
-		compiler.AddSymbol("GetMeshBoundingBox", GetMeshBoundingBox);
+		symbols.AddSymbol("GetMeshBoundingBox", GetMeshBoundingBox);
 		function bool(RaylibBeef.Mesh _mesh, char8* _fileName) ExportMesh = => RaylibBeef.Raylib.ExportMesh;
-		compiler.AddSymbol("ExportMesh", ExportMesh);
+		symbols.AddSymbol("ExportMesh", ExportMesh);
 		function bool(RaylibBeef.Mesh _mesh, char8* _fileName) ExportMeshAsCode = => RaylibBeef.Raylib.ExportMeshAsCode;
-		compiler.AddSymbol("ExportMeshAsCode", ExportMeshAsCode);
+		symbols.AddSymbol("ExportMeshAsCode", ExportMeshAsCode);
 		function RaylibBeef.Mesh(RaylibBeef.Image _heightmap, RaylibBeef.Vector3 _size) GenMeshHeightmap = => RaylibBeef.Raylib.GenMeshHeightmap;
-		compiler.AddSymbol("GenMeshHeightmap", GenMeshHeightmap);
+		symbols.AddSymbol("GenMeshHeightmap", GenMeshHeightmap);
 		function RaylibBeef.Mesh(RaylibBeef.Image _cubicmap, RaylibBeef.Vector3 _cubeSize) GenMeshCubicmap = => RaylibBeef.Raylib.GenMeshCubicmap;
-		compiler.AddSymbol("GenMeshCubicmap", GenMeshCubicmap);
+		symbols.AddSymbol("GenMeshCubicmap", GenMeshCubicmap);
 		function bool(RaylibBeef.Material _material) IsMaterialValid = => RaylibBeef.Raylib.IsMaterialValid;
-		compiler.AddSymbol("IsMaterialValid", IsMaterialValid);
+		symbols.AddSymbol("IsMaterialValid", IsMaterialValid);
 		function void(RaylibBeef.Material _material) UnloadMaterial = => RaylibBeef.Raylib.UnloadMaterial;
-		compiler.AddSymbol("UnloadMaterial", UnloadMaterial);
+		symbols.AddSymbol("UnloadMaterial", UnloadMaterial);
 		function void(RaylibBeef.Material* _material, int32 _mapType, RaylibBeef.Texture _texture) SetMaterialTexture = => RaylibBeef.Raylib.SetMaterialTexture;
-		compiler.AddSymbol("SetMaterialTexture", SetMaterialTexture);
+		symbols.AddSymbol("SetMaterialTexture", SetMaterialTexture);
 		function void(RaylibBeef.Model _model, RaylibBeef.ModelAnimation _anim, int32 _frame) UpdateModelAnimation = => RaylibBeef.Raylib.UpdateModelAnimation;
-		compiler.AddSymbol("UpdateModelAnimation", UpdateModelAnimation);
+		symbols.AddSymbol("UpdateModelAnimation", UpdateModelAnimation);
 		function void(RaylibBeef.Model _model, RaylibBeef.ModelAnimation _anim, int32 _frame) UpdateModelAnimationBones = => RaylibBeef.Raylib.UpdateModelAnimationBones;
-		compiler.AddSymbol("UpdateModelAnimationBones", UpdateModelAnimationBones);
+		symbols.AddSymbol("UpdateModelAnimationBones", UpdateModelAnimationBones);
 		function void(RaylibBeef.ModelAnimation _anim) UnloadModelAnimation = => RaylibBeef.Raylib.UnloadModelAnimation;
-		compiler.AddSymbol("UnloadModelAnimation", UnloadModelAnimation);
+		symbols.AddSymbol("UnloadModelAnimation", UnloadModelAnimation);
 		function bool(RaylibBeef.Model _model, RaylibBeef.ModelAnimation _anim) IsModelAnimationValid = => RaylibBeef.Raylib.IsModelAnimationValid;
-		compiler.AddSymbol("IsModelAnimationValid", IsModelAnimationValid);
+		symbols.AddSymbol("IsModelAnimationValid", IsModelAnimationValid);
 		function bool(RaylibBeef.Vector3 _center1, float _radius1, RaylibBeef.Vector3 _center2, float _radius2) CheckCollisionSpheres = => RaylibBeef.Raylib.CheckCollisionSpheres;
-		compiler.AddSymbol("CheckCollisionSpheres", CheckCollisionSpheres);
+		symbols.AddSymbol("CheckCollisionSpheres", CheckCollisionSpheres);
 		function bool(RaylibBeef.BoundingBox _box1, RaylibBeef.BoundingBox _box2) CheckCollisionBoxes = => RaylibBeef.Raylib.CheckCollisionBoxes;
-		compiler.AddSymbol("CheckCollisionBoxes", CheckCollisionBoxes);
+		symbols.AddSymbol("CheckCollisionBoxes", CheckCollisionBoxes);
 		function bool(RaylibBeef.BoundingBox _box, RaylibBeef.Vector3 _center, float _radius) CheckCollisionBoxSphere = => RaylibBeef.Raylib.CheckCollisionBoxSphere;
-		compiler.AddSymbol("CheckCollisionBoxSphere", CheckCollisionBoxSphere);
+		symbols.AddSymbol("CheckCollisionBoxSphere", CheckCollisionBoxSphere);
 		function RaylibBeef.RayCollision(RaylibBeef.Ray _ray, RaylibBeef.Vector3 _center, float _radius) GetRayCollisionSphere = => RaylibBeef.Raylib.GetRayCollisionSphere;
-		compiler.AddSymbol("GetRayCollisionSphere", GetRayCollisionSphere);
+		symbols.AddSymbol("GetRayCollisionSphere", GetRayCollisionSphere);
 		function RaylibBeef.RayCollision(RaylibBeef.Ray _ray, RaylibBeef.BoundingBox _box) GetRayCollisionBox = => RaylibBeef.Raylib.GetRayCollisionBox;
-		compiler.AddSymbol("GetRayCollisionBox", GetRayCollisionBox);
+		symbols.AddSymbol("GetRayCollisionBox", GetRayCollisionBox);
 		function RaylibBeef.RayCollision(RaylibBeef.Ray _ray, RaylibBeef.Mesh _mesh, RaylibBeef.Matrix _transform) GetRayCollisionMesh = => RaylibBeef.Raylib.GetRayCollisionMesh;
-		compiler.AddSymbol("GetRayCollisionMesh", GetRayCollisionMesh);
+		symbols.AddSymbol("GetRayCollisionMesh", GetRayCollisionMesh);
 		function RaylibBeef.RayCollision(RaylibBeef.Ray _ray, RaylibBeef.Vector3 _p1, RaylibBeef.Vector3 _p2, RaylibBeef.Vector3 _p3) GetRayCollisionTriangle = => RaylibBeef.Raylib.GetRayCollisionTriangle;
-		compiler.AddSymbol("GetRayCollisionTriangle", GetRayCollisionTriangle);
+		symbols.AddSymbol("GetRayCollisionTriangle", GetRayCollisionTriangle);
 		function RaylibBeef.RayCollision(RaylibBeef.Ray _ray, RaylibBeef.Vector3 _p1, RaylibBeef.Vector3 _p2, RaylibBeef.Vector3 _p3, RaylibBeef.Vector3 _p4) GetRayCollisionQuad = => RaylibBeef.Raylib.GetRayCollisionQuad;
-		compiler.AddSymbol("GetRayCollisionQuad", GetRayCollisionQuad);
+		symbols.AddSymbol("GetRayCollisionQuad", GetRayCollisionQuad);
 		function bool(RaylibBeef.Wave _wave) IsWaveValid = => RaylibBeef.Raylib.IsWaveValid;
-		compiler.AddSymbol("IsWaveValid", IsWaveValid);
+		symbols.AddSymbol("IsWaveValid", IsWaveValid);
 		function RaylibBeef.Sound(RaylibBeef.Wave _wave) LoadSoundFromWave = => RaylibBeef.Raylib.LoadSoundFromWave;
-		compiler.AddSymbol("LoadSoundFromWave", LoadSoundFromWave);
+		symbols.AddSymbol("LoadSoundFromWave", LoadSoundFromWave);
 		function RaylibBeef.Sound(RaylibBeef.Sound _source) LoadSoundAlias = => RaylibBeef.Raylib.LoadSoundAlias;
-		compiler.AddSymbol("LoadSoundAlias", LoadSoundAlias);
+		symbols.AddSymbol("LoadSoundAlias", LoadSoundAlias);
 		function bool(RaylibBeef.Sound _sound) IsSoundValid = => RaylibBeef.Raylib.IsSoundValid;
-		compiler.AddSymbol("IsSoundValid", IsSoundValid);
+		symbols.AddSymbol("IsSoundValid", IsSoundValid);
 		function void(RaylibBeef.Sound _sound, void* _data, int32 _sampleCount) UpdateSound = => RaylibBeef.Raylib.UpdateSound;
-		compiler.AddSymbol("UpdateSound", UpdateSound);
+		symbols.AddSymbol("UpdateSound", UpdateSound);
 		function void(RaylibBeef.Wave _wave) UnloadWave = => RaylibBeef.Raylib.UnloadWave;
-		compiler.AddSymbol("UnloadWave", UnloadWave);
+		symbols.AddSymbol("UnloadWave", UnloadWave);
 		function void(RaylibBeef.Sound _sound) UnloadSound = => RaylibBeef.Raylib.UnloadSound;
-		compiler.AddSymbol("UnloadSound", UnloadSound);
+		symbols.AddSymbol("UnloadSound", UnloadSound);
 		function void(RaylibBeef.Sound _alias) UnloadSoundAlias = => RaylibBeef.Raylib.UnloadSoundAlias;
-		compiler.AddSymbol("UnloadSoundAlias", UnloadSoundAlias);
+		symbols.AddSymbol("UnloadSoundAlias", UnloadSoundAlias);
 		function bool(RaylibBeef.Wave _wave, char8* _fileName) ExportWave = => RaylibBeef.Raylib.ExportWave;
-		compiler.AddSymbol("ExportWave", ExportWave);
+		symbols.AddSymbol("ExportWave", ExportWave);
 		function bool(RaylibBeef.Wave _wave, char8* _fileName) ExportWaveAsCode = => RaylibBeef.Raylib.ExportWaveAsCode;
-		compiler.AddSymbol("ExportWaveAsCode", ExportWaveAsCode);
+		symbols.AddSymbol("ExportWaveAsCode", ExportWaveAsCode);
 		function void(RaylibBeef.Sound _sound) PlaySound = => RaylibBeef.Raylib.PlaySound;
-		compiler.AddSymbol("PlaySound", PlaySound);
+		symbols.AddSymbol("PlaySound", PlaySound);
 		function void(RaylibBeef.Sound _sound) StopSound = => RaylibBeef.Raylib.StopSound;
-		compiler.AddSymbol("StopSound", StopSound);
+		symbols.AddSymbol("StopSound", StopSound);
 		function void(RaylibBeef.Sound _sound) PauseSound = => RaylibBeef.Raylib.PauseSound;
-		compiler.AddSymbol("PauseSound", PauseSound);
+		symbols.AddSymbol("PauseSound", PauseSound);
 		function void(RaylibBeef.Sound _sound) ResumeSound = => RaylibBeef.Raylib.ResumeSound;
-		compiler.AddSymbol("ResumeSound", ResumeSound);
+		symbols.AddSymbol("ResumeSound", ResumeSound);
 		function bool(RaylibBeef.Sound _sound) IsSoundPlaying = => RaylibBeef.Raylib.IsSoundPlaying;
-		compiler.AddSymbol("IsSoundPlaying", IsSoundPlaying);
+		symbols.AddSymbol("IsSoundPlaying", IsSoundPlaying);
 		function void(RaylibBeef.Sound _sound, float _volume) SetSoundVolume = => RaylibBeef.Raylib.SetSoundVolume;
-		compiler.AddSymbol("SetSoundVolume", SetSoundVolume);
+		symbols.AddSymbol("SetSoundVolume", SetSoundVolume);
 		function void(RaylibBeef.Sound _sound, float _pitch) SetSoundPitch = => RaylibBeef.Raylib.SetSoundPitch;
-		compiler.AddSymbol("SetSoundPitch", SetSoundPitch);
+		symbols.AddSymbol("SetSoundPitch", SetSoundPitch);
 		function void(RaylibBeef.Sound _sound, float _pan) SetSoundPan = => RaylibBeef.Raylib.SetSoundPan;
-		compiler.AddSymbol("SetSoundPan", SetSoundPan);
+		symbols.AddSymbol("SetSoundPan", SetSoundPan);
 		function RaylibBeef.Wave(RaylibBeef.Wave _wave) WaveCopy = => RaylibBeef.Raylib.WaveCopy;
-		compiler.AddSymbol("WaveCopy", WaveCopy);
+		symbols.AddSymbol("WaveCopy", WaveCopy);
 		function float*(RaylibBeef.Wave _wave) LoadWaveSamples = => RaylibBeef.Raylib.LoadWaveSamples;
-		compiler.AddSymbol("LoadWaveSamples", LoadWaveSamples);
+		symbols.AddSymbol("LoadWaveSamples", LoadWaveSamples);
 		function bool(RaylibBeef.Music _music) IsMusicValid = => RaylibBeef.Raylib.IsMusicValid;
-		compiler.AddSymbol("IsMusicValid", IsMusicValid);
+		symbols.AddSymbol("IsMusicValid", IsMusicValid);
 		function void(RaylibBeef.Music _music) UnloadMusicStream = => RaylibBeef.Raylib.UnloadMusicStream;
-		compiler.AddSymbol("UnloadMusicStream", UnloadMusicStream);
+		symbols.AddSymbol("UnloadMusicStream", UnloadMusicStream);
 		function void(RaylibBeef.Music _music) PlayMusicStream = => RaylibBeef.Raylib.PlayMusicStream;
-		compiler.AddSymbol("PlayMusicStream", PlayMusicStream);
+		symbols.AddSymbol("PlayMusicStream", PlayMusicStream);
 		function bool(RaylibBeef.Music _music) IsMusicStreamPlaying = => RaylibBeef.Raylib.IsMusicStreamPlaying;
-		compiler.AddSymbol("IsMusicStreamPlaying", IsMusicStreamPlaying);
+		symbols.AddSymbol("IsMusicStreamPlaying", IsMusicStreamPlaying);
 		function void(RaylibBeef.Music _music) UpdateMusicStream = => RaylibBeef.Raylib.UpdateMusicStream;
-		compiler.AddSymbol("UpdateMusicStream", UpdateMusicStream);
+		symbols.AddSymbol("UpdateMusicStream", UpdateMusicStream);
 		function void(RaylibBeef.Music _music) StopMusicStream = => RaylibBeef.Raylib.StopMusicStream;
-		compiler.AddSymbol("StopMusicStream", StopMusicStream);
+		symbols.AddSymbol("StopMusicStream", StopMusicStream);
 		function void(RaylibBeef.Music _music) PauseMusicStream = => RaylibBeef.Raylib.PauseMusicStream;
-		compiler.AddSymbol("PauseMusicStream", PauseMusicStream);
+		symbols.AddSymbol("PauseMusicStream", PauseMusicStream);
 		function void(RaylibBeef.Music _music) ResumeMusicStream = => RaylibBeef.Raylib.ResumeMusicStream;
-		compiler.AddSymbol("ResumeMusicStream", ResumeMusicStream);
+		symbols.AddSymbol("ResumeMusicStream", ResumeMusicStream);
 		function void(RaylibBeef.Music _music, float _position) SeekMusicStream = => RaylibBeef.Raylib.SeekMusicStream;
-		compiler.AddSymbol("SeekMusicStream", SeekMusicStream);
+		symbols.AddSymbol("SeekMusicStream", SeekMusicStream);
 		function void(RaylibBeef.Music _music, float _volume) SetMusicVolume = => RaylibBeef.Raylib.SetMusicVolume;
-		compiler.AddSymbol("SetMusicVolume", SetMusicVolume);
+		symbols.AddSymbol("SetMusicVolume", SetMusicVolume);
 		function void(RaylibBeef.Music _music, float _pitch) SetMusicPitch = => RaylibBeef.Raylib.SetMusicPitch;
-		compiler.AddSymbol("SetMusicPitch", SetMusicPitch);
+		symbols.AddSymbol("SetMusicPitch", SetMusicPitch);
 		function void(RaylibBeef.Music _music, float _pan) SetMusicPan = => RaylibBeef.Raylib.SetMusicPan;
-		compiler.AddSymbol("SetMusicPan", SetMusicPan);
+		symbols.AddSymbol("SetMusicPan", SetMusicPan);
 		function float(RaylibBeef.Music _music) GetMusicTimeLength = => RaylibBeef.Raylib.GetMusicTimeLength;
-		compiler.AddSymbol("GetMusicTimeLength", GetMusicTimeLength);
+		symbols.AddSymbol("GetMusicTimeLength", GetMusicTimeLength);
 		function float(RaylibBeef.Music _music) GetMusicTimePlayed = => RaylibBeef.Raylib.GetMusicTimePlayed;
-		compiler.AddSymbol("GetMusicTimePlayed", GetMusicTimePlayed);
+		symbols.AddSymbol("GetMusicTimePlayed", GetMusicTimePlayed);
 		function bool(RaylibBeef.AudioStream _stream) IsAudioStreamValid = => RaylibBeef.Raylib.IsAudioStreamValid;
-		compiler.AddSymbol("IsAudioStreamValid", IsAudioStreamValid);
+		symbols.AddSymbol("IsAudioStreamValid", IsAudioStreamValid);
 		function void(RaylibBeef.AudioStream _stream) UnloadAudioStream = => RaylibBeef.Raylib.UnloadAudioStream;
-		compiler.AddSymbol("UnloadAudioStream", UnloadAudioStream);
+		symbols.AddSymbol("UnloadAudioStream", UnloadAudioStream);
 		function void(RaylibBeef.AudioStream _stream, void* _data, int32 _frameCount) UpdateAudioStream = => RaylibBeef.Raylib.UpdateAudioStream;
-		compiler.AddSymbol("UpdateAudioStream", UpdateAudioStream);
+		symbols.AddSymbol("UpdateAudioStream", UpdateAudioStream);
 		function bool(RaylibBeef.AudioStream _stream) IsAudioStreamProcessed = => RaylibBeef.Raylib.IsAudioStreamProcessed;
-		compiler.AddSymbol("IsAudioStreamProcessed", IsAudioStreamProcessed);
+		symbols.AddSymbol("IsAudioStreamProcessed", IsAudioStreamProcessed);
 		function void(RaylibBeef.AudioStream _stream) PlayAudioStream = => RaylibBeef.Raylib.PlayAudioStream;
-		compiler.AddSymbol("PlayAudioStream", PlayAudioStream);
+		symbols.AddSymbol("PlayAudioStream", PlayAudioStream);
 		function void(RaylibBeef.AudioStream _stream) PauseAudioStream = => RaylibBeef.Raylib.PauseAudioStream;
-		compiler.AddSymbol("PauseAudioStream", PauseAudioStream);
+		symbols.AddSymbol("PauseAudioStream", PauseAudioStream);
 		function void(RaylibBeef.AudioStream _stream) ResumeAudioStream = => RaylibBeef.Raylib.ResumeAudioStream;
-		compiler.AddSymbol("ResumeAudioStream", ResumeAudioStream);
+		symbols.AddSymbol("ResumeAudioStream", ResumeAudioStream);
 		function bool(RaylibBeef.AudioStream _stream) IsAudioStreamPlaying = => RaylibBeef.Raylib.IsAudioStreamPlaying;
-		compiler.AddSymbol("IsAudioStreamPlaying", IsAudioStreamPlaying);
+		symbols.AddSymbol("IsAudioStreamPlaying", IsAudioStreamPlaying);
 		function void(RaylibBeef.AudioStream _stream) StopAudioStream = => RaylibBeef.Raylib.StopAudioStream;
-		compiler.AddSymbol("StopAudioStream", StopAudioStream);
+		symbols.AddSymbol("StopAudioStream", StopAudioStream);
 		function void(RaylibBeef.AudioStream _stream, float _volume) SetAudioStreamVolume = => RaylibBeef.Raylib.SetAudioStreamVolume;
-		compiler.AddSymbol("SetAudioStreamVolume", SetAudioStreamVolume);
+		symbols.AddSymbol("SetAudioStreamVolume", SetAudioStreamVolume);
 		function void(RaylibBeef.AudioStream _stream, float _pitch) SetAudioStreamPitch = => RaylibBeef.Raylib.SetAudioStreamPitch;
-		compiler.AddSymbol("SetAudioStreamPitch", SetAudioStreamPitch);
+		symbols.AddSymbol("SetAudioStreamPitch", SetAudioStreamPitch);
 		function void(RaylibBeef.AudioStream _stream, float _pan) SetAudioStreamPan = => RaylibBeef.Raylib.SetAudioStreamPan;
-		compiler.AddSymbol("SetAudioStreamPan", SetAudioStreamPan);
+		symbols.AddSymbol("SetAudioStreamPan", SetAudioStreamPan);
 		function void(RaylibBeef.AudioStream _stream, RaylibBeef.Raylib.AudioCallback _callback) SetAudioStreamCallback = => RaylibBeef.Raylib.SetAudioStreamCallback;
-		compiler.AddSymbol("SetAudioStreamCallback", SetAudioStreamCallback);
+		symbols.AddSymbol("SetAudioStreamCallback", SetAudioStreamCallback);
 		function void(RaylibBeef.AudioStream _stream, RaylibBeef.Raylib.AudioCallback _processor) AttachAudioStreamProcessor = => RaylibBeef.Raylib.AttachAudioStreamProcessor;
-		compiler.AddSymbol("AttachAudioStreamProcessor", AttachAudioStreamProcessor);
+		symbols.AddSymbol("AttachAudioStreamProcessor", AttachAudioStreamProcessor);
 		function void(RaylibBeef.AudioStream _stream, RaylibBeef.Raylib.AudioCallback _processor) DetachAudioStreamProcessor = => RaylibBeef.Raylib.DetachAudioStreamProcessor;
-		compiler.AddSymbol("DetachAudioStreamProcessor", DetachAudioStreamProcessor);
+		symbols.AddSymbol("DetachAudioStreamProcessor", DetachAudioStreamProcessor);
 	}
 }
\ No newline at end of file